@@ -0,0 +1,209 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+#ifndef DD4HEP_COUNTERRANDOM_H
+#define DD4HEP_COUNTERRANDOM_H
+
+// C/C++ include files
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Philox4x32-10 counter based random number generator
+  /**
+   *  Stateless bijection of a 128 bit counter under a 64 bit key to 128
+   *  random bits. See J.K.Salmon et al., "Parallel random numbers: as easy
+   *  as 1, 2, 3", SC11 (2011).
+   *
+   *  \version 1.0
+   *  \ingroup DD4HEP_CORE
+   */
+  class Philox4x32  {
+  public:
+    static constexpr uint32_t M0 = 0xD2511F53U;
+    static constexpr uint32_t M1 = 0xCD9E8D57U;
+    static constexpr uint32_t W0 = 0x9E3779B9U;
+    static constexpr uint32_t W1 = 0xBB67AE85U;
+
+    /// Encrypt one counter block with the given key
+    static void generate(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4])  {
+      uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+      uint32_t k0 = key[0], k1 = key[1];
+      for( int round = 0; round < 10; ++round )  {
+        uint64_t p0 = uint64_t(M0) * c0;
+        uint64_t p1 = uint64_t(M1) * c2;
+        uint32_t n0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+        uint32_t n2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+        c1 = uint32_t(p1);
+        c3 = uint32_t(p0);
+        c0 = n0;
+        c2 = n2;
+        k0 += W0;
+        k1 += W1;
+      }
+      out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+    }
+  };
+
+  /// Reproducible random number stream based on the Philox4x32-10 generator
+  /**
+   *  The stream is fully defined by the global seed, the run and event
+   *  number, the name of the client (e.g. the action name) and a stream
+   *  index. Hence the random numbers of any event can be reproduced on
+   *  any thread and in any order without saving engine states.
+   *
+   *  The counter holds the run and event number and a 64 bit block index,
+   *  the key is derived from the seed, the name and the stream index.
+   *  Every block delivers four 32 bit words. A double consumes two words,
+   *  a float one word. Bulk draws into arrays yield the same numbers as
+   *  the corresponding sequence of single draws.
+   *
+   *  \version 1.0
+   *  \ingroup DD4HEP_CORE
+   */
+  class CounterRandomStream  {
+    /// Generator key
+    uint32_t m_key[2]     { 0, 0 };
+    /// Counter of the next block: block index (low, high), event, run
+    uint32_t m_ctr[4]     { 0, 0, 0, 0 };
+    /// Random words of the current block
+    uint32_t m_block[4]   { 0, 0, 0, 0 };
+    /// Number of words of the current block already used
+    unsigned m_used       { 4 };
+
+    /// 64 bit finalizer of splitmix64
+    static uint64_t mix64(uint64_t x)  {
+      x ^= x >> 30; x *= 0xBF58476D1CE4E5B9ULL;
+      x ^= x >> 27; x *= 0x94D049BB133111EBULL;
+      return x ^ (x >> 31);
+    }
+    /// Generate the next block and advance the counter
+    void next_block()  {
+      Philox4x32::generate(m_ctr, m_key, m_block);
+      if ( ++m_ctr[0] == 0 ) ++m_ctr[1];
+      m_used = 0;
+    }
+    /// Convert two words to a double in the interval ]0,1]
+    static double to_double(uint32_t hi, uint32_t lo)  {
+      return double(((uint64_t(hi) << 32 | lo) >> 11) + 1) * 0x1.0p-53;
+    }
+    /// Convert one word to a float in the interval ]0,1]
+    static float to_float(uint32_t w)  {
+      return float((w >> 8) + 1) * 0x1.0p-24f;
+    }
+
+  public:
+    typedef uint32_t result_type;
+
+    /// Default constructor
+    CounterRandomStream() = default;
+    /// Initializing constructor
+    CounterRandomStream(uint64_t seed, uint32_t run, uint32_t event, const std::string& name, uint32_t index = 0)  {
+      reset(seed, run, event, name, index);
+    }
+    /// Copy constructor
+    CounterRandomStream(const CounterRandomStream& copy) = default;
+    /// Assignment operator
+    CounterRandomStream& operator=(const CounterRandomStream& copy) = default;
+
+    /// Key of the stream of a named client
+    static uint64_t key(uint64_t seed, const std::string& name, uint32_t index)  {
+      uint64_t h = 0xCBF29CE484222325ULL;     // FNV-1a
+      for( unsigned char c : name )  {
+        h ^= c;
+        h *= 0x100000001B3ULL;
+      }
+      return mix64(mix64(seed) ^ mix64(h + index));
+    }
+    /// Position the stream at the start of the given run, event, client and index
+    void reset(uint64_t seed, uint32_t run, uint32_t event, const std::string& name, uint32_t index = 0)  {
+      uint64_t k = key(seed, name, index);
+      m_key[0] = uint32_t(k);
+      m_key[1] = uint32_t(k >> 32);
+      m_ctr[0] = m_ctr[1] = 0;
+      m_ctr[2] = event;
+      m_ctr[3] = run;
+      m_used   = 4;
+    }
+    /// Position the stream at the given word offset
+    void seek(uint64_t word)  {
+      uint64_t blk = word >> 2;
+      m_ctr[0] = uint32_t(blk);
+      m_ctr[1] = uint32_t(blk >> 32);
+      m_used   = 4;
+      if ( word & 3 )  {
+        next_block();
+        m_used = unsigned(word & 3);
+      }
+    }
+    /// Number of words consumed since the start of the stream
+    uint64_t position()  const  {
+      uint64_t blk = uint64_t(m_ctr[1]) << 32 | m_ctr[0];
+      return m_used == 4 ? 4*blk : 4*(blk-1) + m_used;
+    }
+
+    /// Minimal value of a random word
+    static constexpr result_type min()  {  return 0;            }
+    /// Maximal value of a random word
+    static constexpr result_type max()  {  return 0xFFFFFFFFU;  }
+    /// Next random word (UniformRandomBitGenerator interface)
+    result_type operator()()  {
+      if ( m_used == 4 ) next_block();
+      return m_block[m_used++];
+    }
+    /// Flat distributed random number in the interval ]0,1]
+    double rndm()  {
+      uint32_t hi = (*this)();
+      uint32_t lo = (*this)();
+      return to_double(hi, lo);
+    }
+    /// Fill an array with flat distributed random numbers in the interval ]0,1]
+    void rndmArray(std::size_t n, double* array)  {
+      std::size_t i = 0;
+      while ( i < n && m_used != 4 ) array[i++] = rndm();
+      // Complete blocks: the counters are independent and the loop vectorizes
+      uint64_t blk = uint64_t(m_ctr[1]) << 32 | m_ctr[0];
+      std::size_t nblk = (n - i) / 2;
+      for( std::size_t j = 0; j < nblk; ++j )  {
+        uint64_t b = blk + j;
+        uint32_t ctr[4] = { uint32_t(b), uint32_t(b >> 32), m_ctr[2], m_ctr[3] }, out[4];
+        Philox4x32::generate(ctr, m_key, out);
+        array[i + 2*j]     = to_double(out[0], out[1]);
+        array[i + 2*j + 1] = to_double(out[2], out[3]);
+      }
+      blk += nblk;
+      m_ctr[0] = uint32_t(blk);
+      m_ctr[1] = uint32_t(blk >> 32);
+      for( i += 2*nblk; i < n; ++i ) array[i] = rndm();
+    }
+    /// Fill an array with flat distributed random numbers in the interval ]0,1]
+    void rndmArray(std::size_t n, float* array)  {
+      std::size_t i = 0;
+      while ( i < n && m_used != 4 ) array[i++] = to_float((*this)());
+      uint64_t blk = uint64_t(m_ctr[1]) << 32 | m_ctr[0];
+      std::size_t nblk = (n - i) / 4;
+      for( std::size_t j = 0; j < nblk; ++j )  {
+        uint64_t b = blk + j;
+        uint32_t ctr[4] = { uint32_t(b), uint32_t(b >> 32), m_ctr[2], m_ctr[3] }, out[4];
+        Philox4x32::generate(ctr, m_key, out);
+        for( int k = 0; k < 4; ++k ) array[i + 4*j + k] = to_float(out[k]);
+      }
+      blk += nblk;
+      m_ctr[0] = uint32_t(blk);
+      m_ctr[1] = uint32_t(blk >> 32);
+      for( i += 4*nblk; i < n; ++i ) array[i] = to_float((*this)());
+    }
+  };
+}      // End namespace dd4hep
+#endif // DD4HEP_COUNTERRANDOM_H
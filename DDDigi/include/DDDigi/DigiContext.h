@@ -16,7 +16,7 @@
 // Framework incloude files
 #include <DD4hep/Primitives.h>
 #include <DDDigi/DigiData.h>
-#include <DDDigi/DigiRandomGenerator.h>
+#include <DDDigi/DigiRandomEngine.h>
 
 /// C/C++ include files
 #include <memory>
@@ -124,6 +124,8 @@ namespace dd4hep {
 
       /// Access to the random engine for this event
       DigiRandomGenerator& randomGenerator()  const  { return *m_random; }
+      /// Counter based random engine of a named client for this event
+      DigiRandomEngine randomEngine(const std::string& name, uint32_t index=0)  const;
       /// Access to the user framework. Specialized function to be implemented by the client
       template <typename T> T& framework()  const;
       /// Generic framework access
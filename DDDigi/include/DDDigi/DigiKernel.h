@@ -112,6 +112,8 @@ namespace dd4hep {
       /// Retrieve the global output level of a named object.
       PrintLevel getOutputLevel(const std::string object) const;
 
+      /// Seed of the counter based random engines
+      uint64_t randomSeed()  const;
       /// Access current number of events still to process
       std::size_t events_todo()  const;
       /// Access current number of events already processed
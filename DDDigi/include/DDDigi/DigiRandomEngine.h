@@ -12,13 +12,13 @@
 //==========================================================================
 #ifndef DDDIGI_DIGIRANDOMENGINE_H
 #define DDDIGI_DIGIRANDOMENGINE_H
-#if 0
-/// Framework include files
 
+/// Framework include files
+#include <DDDigi/DigiRandomGenerator.h>
+#include <DD4hep/CounterRandom.h>
 
 /// C/C++ include files
-#include <random>
-#include <functional>
+#include <memory>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -26,39 +26,37 @@ namespace dd4hep {
   /// Namespace for the Digitization part of the AIDA detector description toolkit
   namespace digi {
 
-    /// Generic engine source with a random distribution
+    /// Counter based random engine of the digitization
     /**
-     *  Generate random engine as it appears e.g. from electronic engine
-     *  with a given mean and a given sigma
+     *  The engine is a dd4hep::CounterRandomStream defined by the kernel
+     *  seed, the event number, the name of the client action and a stream
+     *  index. Events are hence reproducible independent of the thread
+     *  and the order of processing.
+     *
+     *  The engine satisfies the UniformRandomBitGenerator requirements
+     *  and may be used directly with the std::random distributions.
+     *  Bulk draws into arrays are supported with rndmArray().
      *
      *  \author  M.Frank
      *  \version 1.0
      *  \ingroup DD4HEP_DIGITIZATION
      */
-    class DigiRandomEngine {
+    class DigiRandomEngine : public CounterRandomStream  {
     public:
-      typedef unsigned int result_type;
-      std::function<double()> m_generator;
-    public:
-      /// Initializing constructor
-      template <typename ENGINE> DigiRandomEngine(ENGINE* engine);
-      /// Default destructor
-      virtual ~DigiRandomEngine();
-      static constexpr result_type min()   { return std::default_random_engine::min(); }
-      static constexpr result_type max()   { return std::default_random_engine::max(); }
-      static constexpr double      range() { return double(max()) - double(min());     }
-      /// Callback to read event randomengine
-      unsigned int operator()()  const     { return m_generator();                     }
+      /// Inherit constructors
+      using CounterRandomStream::CounterRandomStream;
+
+      /// Create a random generator drawing from a copy of this engine
+      std::shared_ptr<DigiRandomGenerator> generator()  const;
     };
-    /// Initializing constructor
-    template <typename ENGINE> DigiRandomEngine::DigiRandomEngine(ENGINE* engine)   {
-      m_generator = [this,engine]()  {
-        static constexpr double norm =
-          DigiRandomEngine::range() / (double(ENGINE::max() - ENGINE::min()));
-        return result_type(double((*engine())) * norm);
-      };
+
+    /// Create a random generator drawing from a copy of this engine
+    inline std::shared_ptr<DigiRandomGenerator> DigiRandomEngine::generator()  const   {
+      auto gen = std::make_shared<DigiRandomGenerator>();
+      auto eng = std::make_shared<DigiRandomEngine>(*this);
+      gen->engine = [eng]()  {  return eng->rndm();  };
+      return gen;
     }
   }    // End namespace digi
 }      // End namespace dd4hep
-#endif
 #endif // DDDIGI_DIGIRANDOMENGINE_H
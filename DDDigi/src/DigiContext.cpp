@@ -50,6 +50,11 @@ std::mutex& DigiContext::global_output_lock()   const  {
   return kernel.global_output_lock();
 }
 
+/// Counter based random engine of a named client for this event
+DigiRandomEngine DigiContext::randomEngine(const std::string& nam, uint32_t index)  const   {
+  return DigiRandomEngine(kernel.randomSeed(), 0, event ? event->eventNumber : 0, nam, index);
+}
+
 /// Access to detector description
 dd4hep::Detector& DigiContext::detectorDescription()  const {
   return kernel.detectorDescription();
@@ -98,6 +98,10 @@ public:
   TRandom* root_random;
   /// Shared random number generator
   std::shared_ptr<DigiRandomGenerator> random  { };
+  /// Property: Seed of the counter based random engines
+  long                  random_seed;
+  /// Property: Use a counter based random engine per event instead of the shared generator
+  bool                  counter_random;
   /// TBB initializer (If TBB is used)
   std::unique_ptr<tbb::global_control> tbb_init { };
   /// Property: Output level
@@ -169,7 +173,13 @@ public:
         int ev_num = kernel.internals->numEvents - todo;
 	std::unique_ptr<DigiContext> context = 
 	  std::make_unique<DigiContext>(this->kernel,std::make_unique<DigiEvent>(ev_num));
-	context->set_random_generator(this->kernel.internals->random);
+        if ( kernel.internals->counter_random )   {
+          auto rndm = context->randomEngine(kernel.name()).generator();
+          context->set_random_generator(rndm);
+        }
+        else   {
+          context->set_random_generator(this->kernel.internals->random);
+        }
         kernel.executeEvent(std::move(context));
       }
     }
@@ -187,6 +197,8 @@ DigiKernel::DigiKernel(Detector& description_ref)
   declareProperty("numEvents",        internals->numEvents = 10);
   declareProperty("stop",             internals->stop = false);
   declareProperty("OutputLevels",     internals->clientLevels);
+  declareProperty("RandomSeed",       internals->random_seed = 123456789);
+  declareProperty("CounterRandom",    internals->counter_random = false);
   auto* h = new DigiMonitorHandler(*this, "MonitorData");
   properties().add("MonitorOutput", h->property("MonitorOutput"));
   internals->monitor_handler = h;
@@ -264,6 +276,11 @@ dd4hep::PrintLevel DigiKernel::getOutputLevel(const std::string object) const
   return dd4hep::PrintLevel(dd4hep::printLevel()-1);
 }
 
+/// Seed of the counter based random engines
+uint64_t DigiKernel::randomSeed()  const   {
+  return uint64_t(internals->random_seed);
+}
+
 /// Access current number of events still to process
 std::size_t DigiKernel::events_todo()  const   {
   std::lock_guard<std::mutex> lock(internals->counter_lock);
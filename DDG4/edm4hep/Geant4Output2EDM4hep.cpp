@@ -55,6 +55,10 @@ namespace podio {
 #endif
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -68,11 +72,29 @@ namespace dd4hep {
 
     /// Base class to output Geant4 event data to EDM4hep
     /**
+     *  All instances writing to the same file share one output stream.
+     *  The event frame is built by each instance without locking and then
+     *  handed over to the stream. If the property WriterThread is set,
+     *  the stream writes the frames from a dedicated thread, which drains
+     *  a bounded queue of WriterQueueSize frames. If OrderEvents is set,
+     *  the event frames are written in ascending order of the Geant4 event
+     *  identifier. At most MaxPendingEvents frames are held back waiting
+     *  for a missing event.
+     *
+     *  The stream options are taken from the instance opening the file.
+     *  The cell ID encodings of all instances are merged into a
+     *  single "metadata" frame, which is written when the last
+     *  instance using the stream releases it.
+     *
      *  \author  F.Gaede
      *  \version 1.0
      *  \ingroup DD4HEP_SIMULATION
      */
     class Geant4Output2EDM4hep : public Geant4OutputAction  {
+    public:
+      /// Output stream shared by all instances writing to the same file
+      class Stream;
+
     protected:
 #if PODIO_BUILD_VERSION >= PODIO_VERSION(1, 0, 0)
       using writer_t = podio::Writer;
@@ -85,7 +107,7 @@ namespace dd4hep {
       using trackermap_t = std::map< std::string, edm4hep::SimTrackerHitCollection >;
       using calorimeterpair_t = std::pair< edm4hep::SimCalorimeterHitCollection, edm4hep::CaloHitContributionCollection >;
       using calorimetermap_t = std::map< std::string, calorimeterpair_t >;
-      std::unique_ptr<writer_t>     m_file  { };
+      std::shared_ptr<Stream>       m_file  { };
       std::atomic_size_t            m_fileUseCount { 0 };
       podio::Frame                  m_frame { };
       edm4hep::MCParticleCollection m_particles { };
@@ -106,6 +128,14 @@ namespace dd4hep {
       int                           m_eventNumberOffset { 0 };
       bool                          m_filesByRun        { false };
       bool                          m_rntuple           { false };
+      /// Property: Write the frames from a dedicated thread
+      bool                          m_writerThread      { false };
+      /// Property: Maximal number of frames queued for the writer thread
+      std::size_t                   m_writerQueueSize   { 16 };
+      /// Property: Write the event frames ordered by the event identifier
+      bool                          m_orderEvents       { false };
+      /// Property: Maximal number of event frames held back to restore the order
+      std::size_t                   m_maxPendingEvents  { 256 };
 
       /// Data conversion interface for MC particles to EDM4hep format
       void saveParticles(Geant4ParticleMap* particles);
@@ -235,6 +265,9 @@ namespace dd4hep {
 #include <DDG4/Geant4Data.h>
 
 ///#include <DDG4/Geant4Output2EDM4hep.h>
+/// ROOT include files
+#include <TROOT.h>
+
 /// Geant4 headers
 #include <G4Threading.hh>
 #include <G4AutoLock.hh>
@@ -254,8 +287,158 @@ using namespace dd4hep;
 
 namespace {
   G4Mutex action_mutex = G4MUTEX_INITIALIZER;
+  /// Output streams by file name. Protected by the action_mutex
+  std::map<std::string, std::shared_ptr<Geant4Output2EDM4hep::Stream> > s_streams;
+  /// Flag if the ROOT thread safety was enabled. Protected by the action_mutex
+  bool s_rootThreadSafety = false;
 }
 
+/// Output stream shared by all instances writing to the same file
+class Geant4Output2EDM4hep::Stream  {
+public:
+  /// Frame to be written
+  struct Entry  {
+    podio::Frame frame;
+    std::string  category;
+    /// Geant4 event identifier. -1 for frames other than events
+    int          event { -1 };
+  };
+  /// File name
+  std::string                 name;
+  /// Number of users (instances and threads) of this stream
+  std::size_t                 users      { 0 };
+
+private:
+  std::unique_ptr<writer_t>   m_writer   { };
+  std::thread                 m_thread   { };
+  std::mutex                  m_lock     { };
+  std::condition_variable     m_haveEntries { };
+  std::condition_variable     m_haveSpace   { };
+  /// Metadata frame merged from all users. Written when the file is closed
+  podio::Frame                m_metadata { };
+  /// Frames queued for the writer thread
+  std::deque<Entry>           m_queue    { };
+  /// Event frames held back to restore the event order
+  std::map<int, Entry>        m_pending  { };
+  std::string                 m_failure  { };
+  std::size_t                 m_queueSize  { 16 };
+  std::size_t                 m_maxPending { 256 };
+  int                         m_nextEvent  { 0 };
+  bool                        m_ordered    { false };
+  bool                        m_stop       { false };
+
+  /// Write a frame. Called only by the thread owning the writer
+  void put(Entry&& entry)  {
+    if ( m_ordered && entry.event >= 0 )   {
+      int evt = entry.event;
+      m_pending.emplace(evt, std::move(entry));
+      flush(false);
+      return;
+    }
+    m_writer->writeFrame(entry.frame, entry.category);
+  }
+  /// Write the held back event frames, which are in order. With all=true write all of them
+  void flush(bool all)  {
+    while ( !m_pending.empty() )   {
+      auto i = m_pending.begin();
+      if ( !all && i->first != m_nextEvent && m_pending.size() <= m_maxPending )
+        break;
+      m_writer->writeFrame(i->second.frame, i->second.category);
+      m_nextEvent = i->first + 1;
+      m_pending.erase(i);
+    }
+  }
+  /// Writer thread: drain the queue until the stream is stopped
+  void run()  {
+    std::unique_lock<std::mutex> guard(m_lock);
+    while ( true )   {
+      m_haveEntries.wait(guard, [this] { return m_stop || !m_queue.empty(); });
+      if ( m_queue.empty() ) break;
+      Entry entry = std::move(m_queue.front());
+      m_queue.pop_front();
+      m_haveSpace.notify_one();
+      guard.unlock();
+      try  {
+        put(std::move(entry));
+      }
+      catch(const std::exception& e)   {
+        printout(ERROR, "Geant4Output2EDM4hep", "+++ Failed to write to %s: %s", name.c_str(), e.what());
+        guard.lock();
+        m_failure = e.what();
+        m_queue.clear();
+        m_haveSpace.notify_all();
+        break;
+      }
+      guard.lock();
+    }
+  }
+
+public:
+  /// Initializing constructor: open the output file and start the writer thread if requested
+  Stream(const std::string& fname, [[maybe_unused]] bool rntuple, bool threaded,
+         std::size_t queue_size, bool ordered, std::size_t max_pending)
+    : name(fname), m_queueSize(std::max(queue_size, std::size_t(1))),
+      m_maxPending(max_pending), m_ordered(ordered)
+  {
+#if PODIO_BUILD_VERSION >= PODIO_VERSION(1, 0, 0)
+    m_writer = std::make_unique<podio::Writer>(podio::makeWriter(fname, rntuple ? "rntuple" : "default"));
+#else
+    m_writer = std::make_unique<podio::ROOTWriter>(fname);
+#endif
+    if ( threaded )   {
+      m_thread = std::thread([this] { this->run(); });
+    }
+  }
+  /// Default destructor
+  ~Stream()   {
+    stop();
+  }
+  /// Stop the writer thread after all queued frames are written
+  void stop()   {
+    if ( m_thread.joinable() )   {
+      {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_stop = true;
+      }
+      m_haveEntries.notify_all();
+      m_thread.join();
+    }
+  }
+  /// Hand a frame over to the stream. Blocks if the queue of the writer thread is full
+  void write(podio::Frame&& frame, const std::string& category, int event = -1)   {
+    std::unique_lock<std::mutex> guard(m_lock);
+    if ( m_thread.joinable() )   {
+      m_haveSpace.wait(guard, [this] { return m_queue.size() < m_queueSize || !m_failure.empty(); });
+    }
+    if ( !m_failure.empty() )   {
+      except("Geant4Output2EDM4hep", "+++ Failed to write output file %s: %s", name.c_str(), m_failure.c_str());
+    }
+    if ( m_thread.joinable() )   {
+      m_queue.emplace_back(Entry{std::move(frame), category, event});
+      m_haveEntries.notify_one();
+      return;
+    }
+    put(Entry{std::move(frame), category, event});
+  }
+  /// Add parameters to the metadata frame, which is written when the file is closed
+  template <typename FUNC> void updateMetaData(FUNC&& update)   {
+    std::lock_guard<std::mutex> guard(m_lock);
+    update(m_metadata);
+  }
+  /// Write all pending frames and the merged metadata frame and close the file
+  void finish()   {
+    stop();
+    if ( m_writer )   {
+      if ( m_failure.empty() )   {
+        flush(true);
+        m_writer->writeFrame(m_metadata, "metadata");
+      }
+      m_writer->finish();
+      m_writer.reset();
+    }
+  }
+};
+
 #include <DDG4/Factories.h>
 DECLARE_GEANT4ACTION(Geant4Output2EDM4hep)
 
@@ -275,6 +458,10 @@ Geant4Output2EDM4hep::Geant4Output2EDM4hep(Geant4Context* ctxt, const std::strin
   declareProperty("SectionName",           m_section_name);
   declareProperty("FilesByRun",            m_filesByRun);
   declareProperty("RNTuple",               m_rntuple);
+  declareProperty("WriterThread",          m_writerThread);
+  declareProperty("WriterQueueSize",       m_writerQueueSize);
+  declareProperty("OrderEvents",           m_orderEvents);
+  declareProperty("MaxPendingEvents",      m_maxPendingEvents);
 
   info("Writer is now instantiated ..." );
   InstanceCount::increment(this);
@@ -297,17 +484,24 @@ void Geant4Output2EDM4hep::beginRun(const G4Run* run)  {
       fname = m_output.substr(0, idx) + _toString(m_runNo, ".run%08d") + m_output.substr(idx);
     }
   }
-  // Create the file only when it has not yet beeen created in another thread
+  // Create the file only when it has not yet beeen created in another thread or instance
   if ( !fname.empty() && !m_file )   {
-#if PODIO_BUILD_VERSION >= PODIO_VERSION(1, 0, 0)
-    m_file = std::make_unique<podio::Writer>(podio::makeWriter(fname, m_rntuple ? "rntuple" : "default"));
-#else
-    m_file = std::make_unique<podio::ROOTWriter>(fname);
-#endif
-    if ( !m_file )   {
-      fatal("+++ Failed to open output file: %s", fname.c_str());
+    auto& stream = s_streams[fname];
+    if ( !stream )   {
+      // The stream is used concurrently by the worker threads or by the writer thread
+      if ( !s_rootThreadSafety && (m_writerThread || G4Threading::IsMultithreadedApplication()) )   {
+        ROOT::EnableThreadSafety();
+        s_rootThreadSafety = true;
+      }
+      stream = std::make_shared<Stream>(fname, m_rntuple, m_writerThread,
+                                        m_writerQueueSize, m_orderEvents, m_maxPendingEvents);
+      printout( INFO, "Geant4Output2EDM4hep" ,"Opened %s for output%s", fname.c_str(),
+                m_writerThread ? " [dedicated writer thread]" : "" ) ;
     }
-    printout( INFO, "Geant4Output2EDM4hep" ,"Opened %s for output", fname.c_str() ) ;
+    m_file = stream;
+  }
+  if ( m_file )   {
+    ++m_file->users;
   }
   m_fileUseCount++;
 }
@@ -321,26 +515,29 @@ void Geant4Output2EDM4hep::endRun(const G4Run* run)  {
   // Note: Although the use count is atomic, the file pointer is not,
   // and testing it requires locking.
   G4AutoLock protection_lock(&action_mutex);
-  if ( m_file && m_fileUseCount == 1 )   {
+  if ( m_file && --m_file->users == 0 )   {
     m_file->finish();
+    s_streams.erase(m_file->name);
+  }
+  if ( m_fileUseCount > 0 && --m_fileUseCount == 0 )   {
     m_file.reset();
   }
-  m_fileUseCount--;
 }
 
 void Geant4Output2EDM4hep::saveFileMetaData() {
-  podio::Frame metaFrame{};
-  for (const auto& [name, encodingStr] : m_cellIDEncodingStrings) {
-    metaFrame.putParameter(podio::collMetadataParamName(name, CellIDEncoding), encodingStr);
+  // The stream merges the metadata of all instances and writes it when the file is closed
+  if ( m_file )   {
+    m_file->updateMetaData([this](podio::Frame& metaFrame)  {
+      for (const auto& [name, encodingStr] : m_cellIDEncodingStrings) {
+        metaFrame.putParameter(podio::collMetadataParamName(name, CellIDEncoding), encodingStr);
+      }
+    });
   }
-  G4AutoLock protection_lock(&action_mutex);
-  m_file->writeFrame(metaFrame, "metadata");
 }
 
 /// Commit data at end of filling procedure
-void Geant4Output2EDM4hep::commit( OutputContext<G4Event>& /* ctxt */)   {
+void Geant4Output2EDM4hep::commit( OutputContext<G4Event>& ctxt)   {
   if ( m_file )   {
-    G4AutoLock protection_lock(&action_mutex);
     m_frame.put( std::move(m_particles), "MCParticles");
     for (auto it = m_trackerHits.begin(); it != m_trackerHits.end(); ++it)   {
       m_frame.put( std::move(it->second), it->first);
@@ -349,7 +546,8 @@ void Geant4Output2EDM4hep::commit( OutputContext<G4Event>& /* ctxt */)   {
       m_frame.put( std::move(calorimeterHits.first), colName);
       m_frame.put( std::move(calorimeterHits.second), colName + "Contributions");
     }
-    m_file->writeFrame(m_frame, m_section_name);
+    // The frame is written by the stream: no lock required here
+    m_file->write(std::move(m_frame), m_section_name, ctxt.context->GetEventID());
     m_particles = { };
     m_trackerHits.clear();
     m_calorimeterHits.clear();
@@ -361,7 +559,6 @@ void Geant4Output2EDM4hep::commit( OutputContext<G4Event>& /* ctxt */)   {
 
 /// Callback to store the Geant4 run information
 void Geant4Output2EDM4hep::saveRun(const G4Run* run)   {
-  G4AutoLock protection_lock(&action_mutex);
   // --- write an edm4hep::RunHeader ---------
   // Runs are just Frames with different contents in EDM4hep / podio. We simply
   // store everything as parameters for now
@@ -390,18 +587,18 @@ void Geant4Output2EDM4hep::saveRun(const G4Run* run)   {
       if ( parameters ) {
         parameters->extractParameters(runHeader);
       }
-      m_file->writeFrame(runHeader, "runs");
+      m_file->write(std::move(runHeader), "runs");
     }
   }
   {
     // In multithreaded running, the run is present in only one of the contexts
     if (context()->runPtr() != nullptr) {
-      podio::Frame metaFrame {};
       FileParameters* parameters = context()->run().extension<FileParameters>(false);
+      podio::Frame metaFrame {};
       if ( parameters ) {
         parameters->extractParameters(metaFrame);
       }
-      m_file->writeFrame(metaFrame, "meta");
+      m_file->write(std::move(metaFrame), "meta");
     }
   }
 }
@@ -19,6 +19,7 @@
 #include <DD4hep/ComponentProperties.h>
 #include <DDG4/Geant4Context.h>
 #include <DDG4/Geant4Callback.h>
+#include <DDG4/Geant4ActionProfiler.h>
 
 // Geant4 forward declarations
 class G4Run;
@@ -197,56 +198,65 @@ namespace dd4hep {
         }
         /// NON-CONST actions
         template <typename R, typename Q> void operator()(R (Q::*pmf)()) {
-          if ( !m_v.empty() )
-            for (const auto& o : m_v)
-              (o->*pmf)();
+          for (const auto& o : m_v)  {
+            Geant4ActionProfiler::Timer timer(o);
+            (o->*pmf)();
+          }
         }
         template <typename R, typename Q, typename A0> void operator()(R (Q::*pmf)(A0), A0 a0) {
-          if ( !m_v.empty() )
-            for (const auto& o : m_v)
-              (o->*pmf)(a0);
+          for (const auto& o : m_v)  {
+            Geant4ActionProfiler::Timer timer(o);
+            (o->*pmf)(a0);
+          }
         }
         template <typename R, typename Q, typename A0, typename A1> void operator()(R (Q::*pmf)(A0, A1), A0 a0, A1 a1) {
-          if ( !m_v.empty() )
-            for (const auto& o : m_v)
-              (o->*pmf)(a0, a1);
+          for (const auto& o : m_v)  {
+            Geant4ActionProfiler::Timer timer(o);
+            (o->*pmf)(a0, a1);
+          }
         }
         /// CONST actions
         template <typename R, typename Q> void operator()(R (Q::*pmf)() const) const {
-          if ( !m_v.empty() )
-            for (const auto& o : m_v)
-              (o->*pmf)();
+          for (const auto& o : m_v)  {
+            Geant4ActionProfiler::Timer timer(o);
+            (o->*pmf)();
+          }
         }
         template <typename R, typename Q, typename A0> void operator()(R (Q::*pmf)(A0) const, A0 a0) const {
-          if ( !m_v.empty() )
-            for (const auto& o : m_v)
-              (o->*pmf)(a0);
+          for (const auto& o : m_v)  {
+            Geant4ActionProfiler::Timer timer(o);
+            (o->*pmf)(a0);
+          }
         }
         template <typename R, typename Q, typename A0, typename A1> void operator()(R (Q::*pmf)(A0, A1) const, A0 a0, A1 a1) const {
-          if ( !m_v.empty() )
-            for (const auto& o : m_v)
-              (o->*pmf)(a0, a1);
+          for (const auto& o : m_v)  {
+            Geant4ActionProfiler::Timer timer(o);
+            (o->*pmf)(a0, a1);
+          }
         }
         /// CONST filters
         template <typename Q> bool filter(bool (Q::*pmf)() const) const {
-          if ( !m_v.empty() )
-            for (const auto& o : m_v)
-              if ( !(o->*pmf)() )
-                return false;
+          for (const auto& o : m_v)  {
+            Geant4ActionProfiler::Timer timer(o);
+            if ( !(o->*pmf)() )
+              return false;
+          }
           return true;
         }
         template <typename Q, typename A0> bool filter(bool (Q::*pmf)(A0) const, A0 a0) const {
-          if ( !m_v.empty() )
-            for (const auto& o : m_v)
-              if ( !(o->*pmf)(a0) )
-                return false;
+          for (const auto& o : m_v)  {
+            Geant4ActionProfiler::Timer timer(o);
+            if ( !(o->*pmf)(a0) )
+              return false;
+          }
           return true;
         }
         template <typename Q, typename A0, typename A1> bool filter(bool (Q::*pmf)(A0, A1) const, A0 a0, A1 a1) const {
-          if ( !m_v.empty() )
-            for (const auto& o : m_v)
-              if ( !(o->*pmf)(a0,a1) )
-                return false;
+          for (const auto& o : m_v)  {
+            Geant4ActionProfiler::Timer timer(o);
+            if ( !(o->*pmf)(a0, a1) )
+              return false;
+          }
           return true;
         }
       };
@@ -284,6 +294,10 @@ namespace dd4hep {
       const char* c_name() const {
         return m_name.c_str();
       }
+      /// Access the call statistics of the action profiler for the calling thread. Created on first access
+      Geant4ActionProfile* profile() const  {
+        return Geant4ActionProfiler::profile(this);
+      }
       /// Set the object name.
       void setName(const std::string& new_name) {
         m_name = new_name;
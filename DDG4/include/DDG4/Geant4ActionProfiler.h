@@ -0,0 +1,169 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+#ifndef DDG4_GEANT4ACTIONPROFILER_H
+#define DDG4_GEANT4ACTIONPROFILER_H
+
+// C/C++ include files
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    // Forward declarations
+    class Geant4Action;
+
+    /// Call statistics of one action object in one thread
+    /**
+     *  Records are keyed by the action instance and the calling thread.
+     *  A shared action called by several threads therefore has one record
+     *  per thread and every record is only updated by its thread.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class Geant4ActionProfile  {
+    public:
+      /// Number of histogram bins: bin i holds calls with 2^(i-1) <= ticks < 2^i
+      enum { NUM_BINS = 48 };
+      /// Action instance. Reset when the action is deleted
+      const Geant4Action* action { nullptr };
+      /// Action name
+      std::string   name;
+      /// Action type
+      std::string   type;
+      /// Identifier of the thread calling the action
+      unsigned long thread     { 0 };
+      /// Number of calls
+      uint64_t      calls      { 0 };
+      /// Accumulated wall time in timer ticks
+      uint64_t      ticks      { 0 };
+      /// Accumulated thread CPU time in nanoseconds (if enabled)
+      uint64_t      cpu        { 0 };
+      /// Largest wall time of a single call in timer ticks
+      uint64_t      maxTicks   { 0 };
+      /// Largest thread CPU time of a single call in nanoseconds (if enabled)
+      uint64_t      maxCpu     { 0 };
+      /// Histogram of the wall time per call (logarithmic bins in timer ticks)
+      uint64_t      histogram[NUM_BINS] { };
+      /// Histogram of the thread CPU time per call (logarithmic bins in nanoseconds, if enabled)
+      uint64_t      cpuHistogram[NUM_BINS] { };
+
+      /// Logarithmic histogram bin of a time interval
+      static int bin(uint64_t dt)  {
+        int b = dt ? 64 - __builtin_clzll(dt) : 0;
+        return b < NUM_BINS ? b : NUM_BINS-1;
+      }
+      /// Add a call
+      void add(uint64_t dt)  {
+        ++calls;
+        ticks += dt;
+        if ( dt > maxTicks ) maxTicks = dt;
+        ++histogram[bin(dt)];
+      }
+      /// Add the thread CPU time of a call
+      void addCpu(uint64_t dt)  {
+        cpu += dt;
+        if ( dt > maxCpu ) maxCpu = dt;
+        ++cpuHistogram[bin(dt)];
+      }
+    };
+
+    /// Per action instrumentation of the DDG4 action sequences
+    /**
+     *  If enabled, the action sequences time every call to their member
+     *  actions with the CPU time stamp counter and record the call count,
+     *  the accumulated time and a histogram of the time per call.
+     *  With level 2 also the thread CPU time and its histogram are recorded,
+     *  which requires a system call per invocation.
+     *
+     *  The profiler is enabled by the Geant4Kernel property ProfileActions.
+     *  If disabled, the timer of an action call only tests a static flag.
+     *  test_Geant4ActionProfiler prints the cost of a disabled profiler.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class Geant4ActionProfiler  {
+      /// Profiling level: 0 = disabled, 1 = wall time, 2 = wall and CPU time
+      static int s_level;
+
+    public:
+      /// Timer for the call of one action
+      /**
+       *  \version 1.0
+       *  \ingroup DD4HEP_SIMULATION
+       */
+      class Timer  {
+        Geant4ActionProfile* m_profile;
+        uint64_t             m_start { 0 };
+        uint64_t             m_cpu   { 0 };
+      public:
+        /// Initializing constructor: start the timer if the profiler is active
+        explicit Timer(const Geant4Action* action)
+          : m_profile(s_level > 0 ? profile(action) : nullptr)
+        {
+          if ( m_profile )  {
+            if ( s_level > 1 ) m_cpu = cpuTime();
+            m_start = ticks();
+          }
+        }
+        /// Default destructor: account the call
+        ~Timer()  {
+          if ( m_profile )  {
+            m_profile->add(ticks() - m_start);
+            if ( s_level > 1 ) m_profile->addCpu(cpuTime() - m_cpu);
+          }
+        }
+      };
+
+      /// Check if the profiler is active
+      static bool active()  {
+        return s_level > 0;
+      }
+      /// Set the profiling level. 0 disables profiling
+      static void enable(int level);
+      /// Current value of the timer
+      static uint64_t ticks()  {
+#if defined(__x86_64__) || defined(__i386__)
+        return __builtin_ia32_rdtsc();
+#else
+        return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+      }
+      /// Thread CPU time in nanoseconds
+      static uint64_t cpuTime()  {
+        struct timespec ts;
+        ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+        return uint64_t(ts.tv_sec)*1000000000ULL + uint64_t(ts.tv_nsec);
+      }
+      /// Timer ticks per second (calibrated against the steady clock)
+      static double ticksPerSecond();
+      /// Access the statistics record of an action for the calling thread. Created on first access
+      static Geant4ActionProfile* profile(const Geant4Action* action);
+      /// Detach the records of an action, which is about to be deleted
+      static void detach(const Geant4Action* action);
+      /// Print the summary of all records
+      static void print();
+      /// Write the summary of all records as JSON file
+      static bool writeJSON(const std::string& file_name);
+      /// Reset all records
+      static void reset();
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+#endif // DDG4_GEANT4ACTIONPROFILER_H
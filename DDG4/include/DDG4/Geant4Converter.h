@@ -57,6 +57,10 @@ namespace dd4hep {
 
       /// Property: Check geometrical overlaps for volume placements and G4 imprints 
       bool       checkOverlaps = true;
+      /// Property: Number of threads for the parallel parts of the conversion (<= 1: sequential)
+      int        numThreads    = 0;
+      /// Property: Minimal number of regularly placed identical daughters to be parameterised (0: disabled)
+      int        detectReplicas = 0;
       /// Property: Output level for debug printing
       PrintLevel outputLevel = INFO;
 
@@ -96,6 +100,12 @@ namespace dd4hep {
       /// Convert the geometry type solid into the corresponding Geant4 object(s).
       virtual void* handleSolid(const std::string& name, const TGeoShape* volume) const;
 
+      /// Parameterise regularly placed identical daughters. Returns the number of parameterised daughters
+      std::size_t handleReplicaPattern(const TGeoVolume* mother) const;
+
+      /// Convert all tessellated solids in parallel. Returns the number of converted solids
+      std::size_t handleTessellatedSolids(const std::vector<TGeoShape*>& solids) const;
+
       /// Convert the geometry type logical volume into the corresponding Geant4 object(s).
       virtual void* handleVolume(const std::string& name, const TGeoVolume* volume) const;
       virtual void* collectVolume(const std::string& name, const TGeoVolume* volume) const;
@@ -21,6 +21,7 @@
 #include <set>
 #include <vector>
 #include <memory>
+#include <cstddef>
 
 // Forward declarations
 class G4Step;
@@ -96,6 +97,31 @@ namespace dd4hep {
       virtual ~DataExtension();
     };
 
+    /// Thread local memory arena for the hits of the default DDG4 sensitive detectors
+    /*
+     *  Hits are allocated from the memory blocks of a per-thread arena. Every chunk
+     *  records the block it was taken from, hence hits may be deleted by any thread:
+     *  e.g. after having been read by ROOT and released by a different thread.
+     *
+     *  When the hit collections are cleared at the end of the event the blocks
+     *  of the event are released in bulk. Blocks without live hits are reused
+     *  by the next event, a block with live hits as soon as its last hit is
+     *  deleted. A long-lived hit keeps only its own block allocated. The thread
+     *  keeps at most 64 free blocks of 64 kB.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class Geant4HitArena  {
+    public:
+      /// Allocate hit memory from the arena of the current thread
+      static void* allocate(std::size_t size);
+      /// Return hit memory to the block it was allocated from. May be called by any thread
+      static void  release(void* ptr);
+      /// Release the blocks of the current event of the current thread
+      static void  endEvent();
+    };
+
     /// Base class for geant4 hit structures used by the default DDG4 sensitive detector implementations
     /*
      *  Base class for geant4 hit structures created by the
@@ -256,6 +282,9 @@ namespace dd4hep {
        * Geant4 tracker hit class. Tracker hits contain the momentum
        * direction as well as the hit position.
        *
+       * Hits are allocated from the thread local Geant4HitArena,
+       * which is kept and reused from event to event.
+       *
        *  \author  M.Frank
        *  \version 1.0
        *  \ingroup DD4HEP_SIMULATION
@@ -291,6 +320,10 @@ namespace dd4hep {
         Hit& operator=(Hit&& c) = delete;
         /// Copy assignment operator
         Hit& operator=(const Hit& c) = delete;
+        /// Object allocator from the thread local hit arena
+        static void* operator new(std::size_t size);
+        /// Object destroyer: return the memory to the hit arena
+        static void operator delete(void* ptr, std::size_t size);
         /// Explicit assignment operation
         void copyFrom(const Hit& c);
         /// Clear hit content
@@ -316,6 +349,9 @@ namespace dd4hep {
        * Geant4 tracker hit class. Calorimeter hits contain the momentum
        * direction as well as the hit position.
        *
+       * Hits are allocated from the thread local Geant4HitArena,
+       * which is kept and reused from event to event.
+       *
        *  \author  M.Frank
        *  \version 1.0
        *  \ingroup DD4HEP_SIMULATION
@@ -345,6 +381,10 @@ namespace dd4hep {
         Hit& operator=(Hit&& c) = delete;
         /// Copy assignment operator
         Hit& operator=(const Hit& c) = delete;
+        /// Object allocator from the thread local hit arena
+        static void* operator new(std::size_t size);
+        /// Object destroyer: return the memory to the hit arena
+        static void operator delete(void* ptr, std::size_t size);
       };
     };
 
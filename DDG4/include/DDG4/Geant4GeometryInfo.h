@@ -19,6 +19,7 @@
 #include <DD4hep/GeoHandler.h>
 #include <DD4hep/PropertyTable.h>
 #include <DDG4/Geant4Primitives.h>
+#include <DDG4/Geant4HashTable.h>
 #include <DDG4/Geant4TouchableHandler.h>
 
 
@@ -80,6 +81,7 @@ namespace dd4hep {
       typedef std::map<Volume,Imprints>                             VolumeImprintMap;
       typedef std::map<const TGeoShape*, G4VSolid*>                 SolidMap;
       typedef std::map<const G4VPhysicalVolume*, PlacedVolume>      G4PlacementMap;
+      typedef std::map<PlacedVolume, PlacedVolume::Object::Parameterisation*> ParameterisationMap;
     }
 
     /// Concreate class holding the relation information between geant4 objects and dd4hep objects.
@@ -100,9 +102,22 @@ namespace dd4hep {
         PlacementFlags(int v) { this->value = v; }
       };
       struct Placement  {
-        VolumeID volumeID;
-        int      flags;
+        VolumeID volumeID   { 0 };
+        int      flags      { 0 };
+        /// Parametrised/replicated paths: offset of the first entry in g4CopyFields
+        uint32_t copyFields { 0 };
       };
+      /// Volume ID field filled with the copy number of a parametrised/replicated placement
+      struct CopyField  {
+        /// Touchable history depth of the placement. Negative for the end of list marker
+        int                            depth { -1 };
+        /// Bitfield to encode the copy number
+        const detail::BitFieldElement* field { nullptr };
+      };
+      /// Sensitive placement paths: frozen after the population of the volume manager
+      typedef Geant4HashTable<Placement> PathTable;
+      /// Reverse placement index G4VPhysicalVolume -> TGeoNode. Built when the info is frozen
+      typedef Geant4HashTable<const TGeoNode*> PlacementIndex;
 
       class DebugInfo;
       TGeoManager*                         manager     { nullptr };
@@ -117,6 +132,10 @@ namespace dd4hep {
       Geant4GeometryMaps::VolumeImprintMap g4VolumeImprints;
       Geant4GeometryMaps::G4PlacementMap   g4Parameterised;
       Geant4GeometryMaps::G4PlacementMap   g4Replicated;
+      /// Parameterisations of regular placements detected by the converter. Owned by this object
+      Geant4GeometryMaps::ParameterisationMap g4Parameterisations;
+      /// Copy number fields of the parametrised/replicated paths. Each list is terminated by depth < 0
+      std::vector<CopyField>               g4CopyFields;
       struct PropertyVector  {
         std::vector<double> bins;
         std::vector<double> values;
@@ -131,7 +150,8 @@ namespace dd4hep {
       std::map<Region,           G4Region*>                    g4Regions;
       std::map<VisAttr,          G4VisAttributes*>             g4Vis;
       std::map<LimitSet,         G4UserLimits*>                g4Limits;
-      std::map<uint64_t,         Placement>                    g4Paths;
+      PathTable                                                g4Paths;
+      PlacementIndex                                           g4PlacementIndex;
       std::map<SensitiveDetector,std::set<const TGeoVolume*> > sensitives;
       std::map<Region,           std::set<const TGeoVolume*> > regions;
       std::map<LimitSet,         std::set<const TGeoVolume*> > limits;
@@ -139,6 +159,7 @@ namespace dd4hep {
       PrintLevel                                               printLevel;
       bool                                                     has_volmgr { false };
       bool                                                     valid      { false };
+      bool                                                     frozen     { false };
 
       /// Assemble Geant4 volume path
       static std::string placementPath(const Geant4TouchableHandler::Geant4PlacementPath& path, bool reverse=true)  {
@@ -157,6 +178,16 @@ namespace dd4hep {
       G4VPhysicalVolume* world() const;
       /// Set the world volume
       void setWorld(const TGeoNode* node);
+      /// Access the dd4hep placement of a Geant4 physical volume. Invalid handle if not found
+      PlacedVolume placement(const G4VPhysicalVolume* pv)  const;
+      /// Release the maps only needed during the conversion. Returns the number of bytes released
+      /** After the volume manager is populated only the materials, logical volumes,
+       *  regions, sensitive volumes and assemblies are required to construct the
+       *  sensitive detectors of the worker threads.
+       *  All other maps are released and the placements are replaced by the
+       *  reverse index g4PlacementIndex, which may be read by all threads.
+       */
+      std::size_t freeze();
     };
   }    // End namespace sim
 }      // End namespace dd4hep
@@ -0,0 +1,221 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+#ifndef DDG4_GEANT4HASHTABLE_H
+#define DDG4_GEANT4HASHTABLE_H
+
+// Framework include files
+#include <DD4hep/Printout.h>
+
+// C/C++ include files
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Compact open addressing hash table with 64 bit keys
+    /**
+     *  Keys and values are stored in two contiguous arrays. Collisions are
+     *  resolved by linear probing. The key 0 marks empty slots; an entry
+     *  with key 0 is kept aside.
+     *
+     *  The table is filled once and then frozen: freezing shrinks the table
+     *  to the smallest power of 2 with a load factor below 3/4. A frozen
+     *  table is never modified and may be shared by any number of threads
+     *  without locking.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    template <typename VALUE> class Geant4HashTable  {
+    public:
+      typedef uint64_t key_type;
+      typedef VALUE    mapped_type;
+
+    private:
+      /// Slot keys. 0 denotes an empty slot
+      std::vector<key_type> m_keys;
+      /// Slot values
+      std::vector<VALUE>    m_values;
+      /// Value of the key 0 if present
+      VALUE                 m_zero       { };
+      /// Slot mask: capacity - 1
+      std::size_t           m_mask       { 0 };
+      /// Number of entries
+      std::size_t           m_size       { 0 };
+      /// Flag if the key 0 is present
+      bool                  m_haveZero   { false };
+      /// Flag if the table is frozen
+      bool                  m_frozen     { false };
+
+      /// Spread the key bits over the slot index (64 bit finalizer of MurmurHash3)
+      static std::size_t slot(key_type key)  {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        return std::size_t(key);
+      }
+      /// Smallest power of 2 capacity holding n entries with a load factor below limit_num/limit_den
+      static std::size_t capacity_for(std::size_t n, std::size_t limit_num, std::size_t limit_den)  {
+        std::size_t cap = 16;
+        while( cap * limit_num <= n * limit_den ) cap <<= 1;
+        return cap;
+      }
+      /// Insert without checks into a table with sufficient capacity
+      /** New entries are default constructed: after reset() the slots still hold old values */
+      VALUE& place(key_type key)  {
+        for( std::size_t i = slot(key) & m_mask; ; i = (i+1) & m_mask )  {
+          if( m_keys[i] == key )
+            return m_values[i];
+          else if( m_keys[i] == 0 )  {
+            m_keys[i]   = key;
+            m_values[i] = VALUE();
+            ++m_size;
+            return m_values[i];
+          }
+        }
+      }
+      /// Re-hash all entries into a table of the given capacity
+      void rehash(std::size_t cap)  {
+        std::vector<key_type> keys(cap, 0);
+        std::vector<VALUE>    values(cap);
+        keys.swap(m_keys);
+        values.swap(m_values);
+        m_mask = cap - 1;
+        m_size = 0;
+        for( std::size_t i = 0; i < keys.size(); ++i )  {
+          if( keys[i] != 0 ) place(keys[i]) = values[i];
+        }
+        if( m_haveZero ) ++m_size;
+      }
+
+    public:
+      /// Default constructor
+      Geant4HashTable() = default;
+      /// Move constructor
+      Geant4HashTable(Geant4HashTable&& copy) = default;
+      /// Copy constructor
+      Geant4HashTable(const Geant4HashTable& copy) = default;
+      /// Default destructor
+      ~Geant4HashTable() = default;
+      /// Move assignment
+      Geant4HashTable& operator=(Geant4HashTable&& copy) = default;
+      /// Assignment operator
+      Geant4HashTable& operator=(const Geant4HashTable& copy) = default;
+
+      /// Number of entries
+      std::size_t size()  const      {  return m_size;          }
+      /// Check if the table has entries
+      bool empty()  const            {  return m_size == 0;     }
+      /// Number of slots
+      std::size_t capacity()  const  {  return m_keys.size();   }
+      /// Check if the table is frozen
+      bool frozen()  const           {  return m_frozen;        }
+      /// Memory occupied by the slot arrays in bytes
+      std::size_t memoryUsage()  const  {
+        return m_keys.capacity()*sizeof(key_type) + m_values.capacity()*sizeof(VALUE);
+      }
+
+      /// Pre-allocate the table for n entries
+      void reserve(std::size_t n)  {
+        std::size_t cap = capacity_for(n, 1, 2);
+        if( cap > m_keys.size() ) rehash(cap);
+      }
+
+      /// Access an entry for insertion. Creates a default entry if the key is not present
+      VALUE& operator[](key_type key)  {
+        if( m_frozen )  {
+          except("Geant4HashTable","+++ Attempt to insert key %016llX into frozen table.",
+                 (unsigned long long)key);
+        }
+        if( key == 0 )  {
+          if( !m_haveZero ) ++m_size;
+          m_haveZero = true;
+          return m_zero;
+        }
+        // Grow at load factor 1/2
+        if( 2*(m_size+1) > m_keys.size() )  {
+          rehash(capacity_for(m_size+1, 1, 2));
+        }
+        return place(key);
+      }
+
+      /// Insert an entry. Returns false and leaves the table unchanged if the key exists
+      bool insert(key_type key, const VALUE& value)  {
+        if( find(key) ) return false;
+        (*this)[key] = value;
+        return true;
+      }
+
+      /// Lookup an entry. Returns nullptr if the key is not present
+      const VALUE* find(key_type key)  const  {
+        if( key == 0 )
+          return m_haveZero ? &m_zero : nullptr;
+        else if( m_keys.empty() )
+          return nullptr;
+        const key_type* keys = m_keys.data();
+        for( std::size_t i = slot(key) & m_mask; ; i = (i+1) & m_mask )  {
+          if( keys[i] == key )
+            return &m_values[i];
+          else if( keys[i] == 0 )
+            return nullptr;
+        }
+      }
+
+      /// Shrink the table to its final size. Afterwards no insertions are allowed
+      void freeze()  {
+        if( !m_frozen )  {
+          std::size_t num = m_haveZero ? m_size - 1 : m_size;
+          std::size_t cap = capacity_for(num, 3, 4);
+          if( cap != m_keys.size() ) rehash(cap);
+          m_keys.shrink_to_fit();
+          m_values.shrink_to_fit();
+          m_frozen = true;
+        }
+      }
+
+      /// Remove all entries, but keep the allocated memory. Unfreezes the table
+      void reset()  {
+        std::fill(m_keys.begin(), m_keys.end(), key_type(0));
+        m_zero     = VALUE();
+        m_size     = 0;
+        m_haveZero = false;
+        m_frozen   = false;
+      }
+
+      /// Remove all entries, release the memory and unfreeze the table
+      void clear()  {
+        std::vector<key_type>().swap(m_keys);
+        std::vector<VALUE>().swap(m_values);
+        m_zero     = VALUE();
+        m_mask     = 0;
+        m_size     = 0;
+        m_haveZero = false;
+        m_frozen   = false;
+      }
+
+      /// Call the functor for every entry: func(key_type key, const VALUE& value)
+      template <typename FUNCTOR> void for_each(FUNCTOR func)  const  {
+        if( m_haveZero ) func(key_type(0), m_zero);
+        for( std::size_t i = 0; i < m_keys.size(); ++i )  {
+          if( m_keys[i] != 0 ) func(m_keys[i], m_values[i]);
+        }
+      }
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+#endif // DDG4_GEANT4HASHTABLE_H
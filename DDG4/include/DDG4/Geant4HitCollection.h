@@ -16,6 +16,7 @@
 // Framework include files
 #include <DD4hep/Handle.h>
 #include <DDG4/ComponentUtils.h>
+#include <DDG4/Geant4HashTable.h>
 #include <G4VHitsCollection.hh>
 #include <G4VHit.hh>
 
@@ -206,7 +207,7 @@ namespace dd4hep {
       /// Hit manipulator
       typedef Geant4HitWrapper::HitManipulator Manip;
       /// Hit key map for fast random lookup
-      typedef std::map<VolumeID, size_t>  Keys;
+      typedef Geant4HashTable<size_t>          Keys;
 
       /// Generic class template to compare/select hits in Geant4HitCollection objects
       /**
@@ -245,14 +246,18 @@ namespace dd4hep {
       Manip*                           m_manipulator;
       /// Memorize for speedup the last searched hit
       size_t                           m_lastHit;
-      /// Hit key map for fast random lookup
+      /// Hit key map for fast random lookup. The memory is recycled between events
       Keys                             m_keys;
+      /// Number of keys to reserve in the key map before the first keyed insertion
+      size_t                           m_keyReserve { 0 };
       /// Optimization flags
       CollectionFlags                  m_flags;
       
     protected:
       /// Notification to increase the instance counter
       void newInstance();
+      /// Prepare the key map before the first keyed insertion
+      void prepareKeys();
       /// Find hit in a collection by comparison of attributes
       void* findHit(const Compare& cmp);
       /// Find hit in a collection by comparison of the key
@@ -338,8 +343,10 @@ namespace dd4hep {
       /// Add a new hit with a check, that the hit is of the same type
       template <typename TYPE> void add(VolumeID key, TYPE* hit_pointer) {
         m_lastHit = m_hits.size();
-        std::pair<Keys::iterator,bool> ret = m_keys.emplace(key,m_lastHit);
-        if ( ret.second )  {
+        if ( m_keys.capacity() == 0 )  {
+          prepareKeys();
+        }
+        if ( m_keys.insert(key, m_lastHit) )  {
           Geant4HitWrapper w(m_manipulator->castHit(hit_pointer));
           m_hits.emplace_back(w);
           return;
@@ -352,9 +359,9 @@ namespace dd4hep {
       }
       /// Find hits in a collection by comparison of key value
       template <typename TYPE> TYPE* findByKey(VolumeID key) {
-        Keys::const_iterator i=m_keys.find(key);
-        if ( i == m_keys.end() ) return 0;
-        m_lastHit = (*i).second;
+        const size_t* i = m_keys.find(key);
+        if ( !i ) return 0;
+        m_lastHit = *i;
         TYPE* obj = m_hits.at(m_lastHit);
         return obj;
       }
@@ -365,7 +372,7 @@ namespace dd4hep {
           releaseData(ComponentCast::instance<TYPE>(), (std::vector<void*>*) &vec);
         }
         m_lastHit = ULONG_MAX;
-        m_keys.clear();
+        m_keys.reset();
         return vec;
       }
       /// Release all hits from the Geant4 container and pass ownership to the caller
@@ -432,6 +439,37 @@ namespace dd4hep {
       return 0;
     }
 
+    /// Hash key of a hit position for the merging of hits by position
+    /**
+     *  -0.0 and 0.0 compare equal and get the same key.
+     */
+    template <typename POS> VolumeID hitPositionKey(const POS& pos)  {
+      const double xyz[3] = { pos.x() + 0e0, pos.y() + 0e0, pos.z() + 0e0 };
+      return detail::hash64(xyz, sizeof(xyz));
+    }
+
+    /// Find a hit with exactly the given position using the hashed position as key
+    /**
+     *  If the key matches, but the position does not (hash collision), the
+     *  hit may have been added without key: the collection is scanned.
+     */
+    template <typename TYPE, typename POS>
+    TYPE* findHitByPosition(Geant4HitCollection& coll, const POS& pos, VolumeID key)  {
+      TYPE* hit = coll.findByKey<TYPE>(key);
+      if ( !hit || hit->position == pos )  {
+        return hit;
+      }
+      return coll.find<TYPE>(PositionCompare<TYPE,POS>(pos));
+    }
+
+    /// Add a hit keyed by its hashed position. Hits with colliding keys are added without key
+    template <typename TYPE> void addHitByPosition(Geant4HitCollection& coll, TYPE* hit, VolumeID key)  {
+      if ( coll.findByKey<TYPE>(key) )
+        coll.add(hit);
+      else
+        coll.add(key, hit);
+    }
+
   }    // End namespace sim
 }      // End namespace dd4hep
 
@@ -149,6 +149,12 @@ namespace dd4hep  {
      * Concrete implementation of the Geant4 generator action base class
      * populating Geant4 primaries from Geant4 and HepStd files.
      *
+     * If the property Prefetch is larger than 0, the events are decoded
+     * ahead by a background thread, which keeps up to Prefetch events
+     * ready in a bounded queue. Event extensions created by the reader
+     * (e.g. EventParameters) are attached to the event when it is consumed.
+     * Prefetching requires events to be requested in sequential order.
+     *
      *  \author  P.Kostka (main author)
      *  \author  M.Frank  (code reshuffeling into new DDG4 scheme)
      *  \version 1.0
@@ -178,6 +184,11 @@ namespace dd4hep  {
       bool m_abort;
       /// Property: named parameters to configure file readers or input actions
       std::map< std::string, std::string> m_parameters;
+      /// Property: number of events decoded ahead by a background thread (0: disabled)
+      int m_prefetch { 0 };
+      /// Read-ahead stage used if m_prefetch > 0
+      class Prefetch;
+      std::unique_ptr<Prefetch> m_prefetchStage;   //!
 
       /// Property: set of alternative decay statuses that MC generators might use for unstable particles
       std::set<int> m_alternativeDecayStatuses = {};
@@ -190,6 +201,8 @@ namespace dd4hep  {
 
       /// Create the input reader
       void createReader();
+      /// Handle the status of the event reader: abort or throw on errors
+      int handleReaderStatus(int event_number, int status);
     public:
       /// Read an event and return a LCCollectionVec of MCParticles.
       int readParticles(int event_number,
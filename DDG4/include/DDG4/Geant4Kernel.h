@@ -93,6 +93,8 @@ namespace dd4hep {
       Phases        m_phases                   { };
       /// Worker threads
       Workers       m_workers                  { };
+      /// Worker instances replaced by a new worker created for a recycled thread identifier
+      std::vector<Geant4Kernel*> m_retiredWorkers { };
       /// Globally registered actions
       GlobalActions m_globalActions            { };
       /// Globally registered filters of sensitive detectors
@@ -116,10 +118,16 @@ namespace dd4hep {
 
       /// Master property: Number of execution threads in multi threaded mode.
       int           m_numThreads     = 0;
+      /// Master property: Number of events per task of the task based run managers (0: Geant4 default)
+      int           m_eventGrainsize = 0;
       /// Master property: Instantiate the Geant4 scoring manager object
       int           m_haveScoringMgr = false;
       /// Master property: Flag if event loop is enabled
       int           m_processEvents  = EVENTLOOP_RUNNING;
+      /// Master property: Action profiling level (0: off, 1: wall time, 2: wall and CPU time)
+      int           m_profileActions = 0;
+      /// Master property: Name of the JSON file for the action profile report
+      std::string   m_profileReport  { };
 
       
       /// Registered action callbacks on configure
@@ -337,7 +345,7 @@ namespace dd4hep {
       /** Geant4 Multi threading support */
       /// Create identified worker instance
       virtual Geant4Kernel& createWorker();
-      /// Access worker instance by its identifier
+      /// Access worker instance by its identifier. Throws if the worker does not exist and create_if is false
       Geant4Kernel& worker(unsigned long thread_identifier, bool create_if=false);
       /// Access number of workers
       int numWorkers() const;
@@ -352,6 +360,8 @@ namespace dd4hep {
       virtual int runEvents(int num_events);
       /// Run the simulation: Terminate Geant4
       virtual int terminate()  override;
+      /// Print the action profile and write the report if the profiler is enabled
+      void printProfile()  const;
     };
     /// Declare property
     template <typename T> Geant4Kernel& Geant4Kernel::declareProperty(const std::string& nam, T& val) {
@@ -45,6 +45,8 @@ namespace dd4hep {
       long                debugVolManager {     0 };
       /// Disable building Geant4 voilume manager. Throw exception when accessed.
       bool                haveVolManager  {  true };
+      /// Release the conversion-only maps once the geometry construction is complete
+      bool                freezeGeometry  { false };
       
     public:
       /// Initializing Constructor
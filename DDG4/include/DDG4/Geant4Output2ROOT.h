@@ -20,6 +20,7 @@
 
 class TFile;
 class TTree;
+class TDirectory;
 class TBranch;
 
 /// Namespace for the AIDA detector description toolkit
@@ -32,6 +33,18 @@ namespace dd4hep {
 
     /// Class to output Geant4 event data to ROOT files
     /**
+     *  In multi-threaded mode the property BufferMerger allows each instance
+     *  to fill its own tree in a memory buffer. The buffers are merged into the
+     *  output file by ROOT's TBufferMerger every FlushEvents events.
+     *  All instances writing the same file share the merger. To fill the
+     *  buffers concurrently, the action must be instantiated per worker thread
+     *  and not as a shared action.
+     *  The merger requires all buffers to have the same branches. Therefore
+     *  the branches of the particle record and of all hit collections of
+     *  the sensitive detectors are declared at the begin of the run, before
+     *  the first buffer is handed to the merger. Collections not declared
+     *  at the begin of the run cannot be written in this mode.
+     *
      *  \author  M.Frank
      *  \version 1.0
      *  \ingroup DD4HEP_SIMULATION
@@ -40,13 +53,17 @@ namespace dd4hep {
     protected:
       using Branches = std::map<std::string, TBranch*>;
       using Sections = std::map<std::string, TTree*>;
+      /// Output buffer of the instance in buffer merger mode
+      struct MergerOutput;
       /// Known file sections
       Sections m_sections;
       /// Branches in the event tree
       Branches m_branches;
       /// Reference to the ROOT file to open
       std::unique_ptr<TFile> m_file;
-      /// Reference to the event data tree (owned by m_file)
+      /// Reference to the output buffer in buffer merger mode
+      std::unique_ptr<MergerOutput> m_merger;
+      /// Reference to the event data tree (owned by m_file or the merger buffer)
       TTree* m_tree = nullptr;
       /// Property: name of the event tree
       std::string m_section;
@@ -58,6 +75,19 @@ namespace dd4hep {
       bool m_handleMCTruth = true;
       /// Property: Flag to create a new output file for each run
       bool m_filesByRun = false;
+      /// Property: Flag to write through per instance buffers merged by TBufferMerger
+      bool m_bufferMerger = false;
+      /// Property: Number of events after which the buffer is handed to the merger
+      int  m_flushEvents = 100;
+      /// Property: Number of threads for ROOT implicit multi-threading (compression). 0: unchanged
+      int  m_implicitMT = 0;
+
+      /// Access the directory of the current output (file or merger buffer)
+      TDirectory* outputDirectory()  const;
+      /// Create/access the event tree branch of a collection
+      TBranch* branch(const std::string& nam, const ComponentCast& type);
+      /// Declare the branches of all collections, which may be written during the run
+      void declareBranches();
 
     public:
       /// Standard constructor
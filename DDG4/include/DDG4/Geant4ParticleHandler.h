@@ -124,6 +124,37 @@ namespace dd4hep {
       bool              m_haveSuspended = false;
       /// Map associating the G4Track identifiers with identifiers of existing MCParticles
       TrackEquivalents  m_equivalentTracks;
+      /// Particle store used during the event indexed by the G4Track identifier (after rebasing: by particle identifier)
+      std::vector<Particle*> m_particles;
+      /// Track equivalents used during the event indexed by the G4Track identifier. -1 if not present
+      std::vector<int>       m_equivalents;
+      /// Pool of unused particle objects for reuse in subsequent tracks
+      std::vector<Particle*> m_particlePool;
+
+      /// Access a particle of the event store. Returns nullptr if not present
+      Particle* particle(int id)  const  {
+        return (id >= 0 && std::size_t(id) < m_particles.size()) ? m_particles[id] : nullptr;
+      }
+      /// Access the slot of a particle in the event store. The store is extended if necessary
+      Particle*& particleSlot(int id)  {
+        if ( std::size_t(id) >= m_particles.size() ) m_particles.resize(2*id+1, nullptr);
+        return m_particles[id];
+      }
+      /// Access the equivalent of a G4Track identifier. Returns -1 if not present
+      int equivalent(int id)  const  {
+        return (id >= 0 && std::size_t(id) < m_equivalents.size()) ? m_equivalents[id] : -1;
+      }
+      /// Set the equivalent of a G4Track identifier
+      void setEquivalent(int id, int equiv)  {
+        if ( std::size_t(id) >= m_equivalents.size() ) m_equivalents.resize(2*id+1, -1);
+        m_equivalents[id] = equiv;
+      }
+      /// Create a new particle object. Pooled objects are reused
+      Particle* newParticle();
+      /// Release a particle object. Objects not referenced elsewhere are returned to the pool
+      void releaseParticle(Particle* p);
+      /// Convert the event store to the particle map and the track equivalents
+      void fillParticleMap();
 
       /// Recombine particles and associate the to parents with cleanup
       int recombineParents();
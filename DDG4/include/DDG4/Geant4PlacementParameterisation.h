@@ -92,6 +92,8 @@ namespace dd4hep {
     public:
       /// Initializing constructor
       Geant4PlacementParameterisation(PlacedVolume pv);
+      /// Initializing constructor with parameters not attached to the placement
+      Geant4PlacementParameterisation(PlacedVolume pv, const Parameters& params);
       /// Standard destructor
       virtual ~Geant4PlacementParameterisation() = default;
       /// Access Axis direction
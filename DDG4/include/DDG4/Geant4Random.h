@@ -15,6 +15,7 @@
 
 // Framework include files
 #include <DDG4/Geant4Action.h>
+#include <DD4hep/CounterRandom.h>
 
 // C/C++ include files
 #include <string>
@@ -52,6 +53,12 @@ namespace dd4hep {
      *  to be the Geant4 instance. If another instance should be used by 
      *  Geant4, use setMainInstance(Geant4Random* ptr).
      *
+     *  Independent of the engine the instance delivers counter based random
+     *  streams (see dd4hep::CounterRandomStream). A stream is defined by the
+     *  seed, the run and event number, the name of the client and a stream
+     *  index. Events can then be reproduced on any thread without saving
+     *  engine states.
+     *
      *  \author  M.Frank
      *  \version 1.0
      *  \ingroup DD4HEP_SIMULATION
@@ -68,6 +75,8 @@ namespace dd4hep {
       long         m_seed, m_luxury;
       /// Property: Indicator to replace the ROOT gRandom instance
       bool         m_replace;
+      /// Seed of the counter based streams. Fixed at initialization, unaffected by reseeding
+      long         m_streamSeed;
       
       /// Reference to the CLHEP random number engine (valid only after initialization)
       CLHEP::HepRandomEngine* m_engine;
@@ -165,6 +174,13 @@ namespace dd4hep {
       double poisson(double mean=1e0 );
       /// Create breit wigner distributed random numbers
       double breit_wigner(double mean=0e0, double gamma=1e0);
+
+      /** Counter based random streams  */
+
+      /// Random stream of a named client for a given run and event
+      CounterRandomStream stream(unsigned int run, unsigned int event, const std::string& name, unsigned int index=0)  const;
+      /// Random stream of an action for the run and event of its context
+      CounterRandomStream stream(const Geant4Action* action, unsigned int index=0)  const;
     };
 
   }    // End namespace sim
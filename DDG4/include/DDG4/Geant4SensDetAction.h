@@ -17,6 +17,7 @@
 #include <DD4hep/Detector.h>
 #include <DDG4/Geant4Action.h>
 #include <DDG4/Geant4HitCollection.h>
+#include <DDG4/Geant4Data.h>
 
 // Geant4 include files
 #include <G4ThreeVector.hh>
@@ -32,6 +33,8 @@ class G4Event;
 class G4TouchableHistory;
 class G4VHitsCollection;
 class G4VReadOutGeometry;
+class G4VPhysicalVolume;
+class G4ParticleDefinition;
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -94,6 +97,24 @@ namespace dd4hep {
      *  \ingroup DD4HEP_SIMULATION
      */
     class Geant4Filter: public Geant4Action {
+    public:
+      /// Description of a filter as a term of a fused filter chain
+      /**
+       *  Simple filters describe themselves by a test on the energy deposit
+       *  or the particle type of the step. These tests are evaluated inline
+       *  by the filter chain of the sensitive detector sequence.
+       *  All other filters are GENERIC and invoked by their operator().
+       */
+      struct Term  {
+        enum Type { GENERIC = 0, ENERGY_CUT, REJECT_PARTICLE, SELECT_PARTICLE };
+        /// Type of the test
+        Type                        type          { GENERIC };
+        /// ENERGY_CUT: Accept steps with energy deposit above the cut
+        double                      cut           { 0e0 };
+        /// REJECT_PARTICLE / SELECT_PARTICLE: particle definitions (unused slots are NULL)
+        const G4ParticleDefinition* particles[2]  { nullptr, nullptr };
+      };
+
     protected:
       /// Define standard assignments and constructors
       DDG4_DEFINE_ACTION_CONSTRUCTORS(Geant4Filter);
@@ -104,6 +125,9 @@ namespace dd4hep {
       /// Standard destructor
       virtual ~Geant4Filter();
 
+      /// Describe the filter as a term of a fused filter chain. Default: GENERIC
+      virtual Term term() const;
+
       /// Filter action. Return true if hits should be processed. Default returns true
       virtual bool operator()(const G4Step* step) const;
 
@@ -127,6 +151,18 @@ namespace dd4hep {
         MEDIUM_MODE = 1<<0,
         DETAILED_MODE = 1<<1
       };
+      /// Monte Carlo truth record of calorimeter hits
+      enum TruthModes {
+        /// Keep every contribution
+        TRUTH_ALL = 0,
+        /// One contribution per track: deposits and lengths summed, earliest time, energy weighted position
+        TRUTH_MERGE_TRACKS = 1,
+        /// As TRUTH_MERGE_TRACKS, but keep only the contributions of the tracks with the largest deposits.
+        /// The deposits of all other tracks are summed in one additional entry
+        TRUTH_TOP_N = 2,
+        /// One energy weighted contribution per hit carrying the track and PDG identifiers of the first contribution
+        TRUTH_AGGREGATE = 3
+      };
 
     private:
       /// Reference to G4 sensitive detector
@@ -134,6 +170,29 @@ namespace dd4hep {
       /// Reference to the containing action sequence
       Geant4SensDetActionSequence* m_sequence { nullptr };
 
+      /// Volume ID of the last touchable resolved by the volume manager
+      /** Sensitive actions are instantiated for every worker thread:
+       *  the cache is private to the sensitive action and the thread.
+       */
+      struct VolumeCache  {
+        /// Physical volumes of the last touchable history (leaf first, world excluded)
+        std::vector<const G4VPhysicalVolume*> volumes;
+        /// Replica/copy numbers of the last touchable history
+        std::vector<int>                      copies;
+        /// Resolved volume ID
+        VolumeID                              volumeID  { 0 };
+        /// Number of cache lookups
+        unsigned long                         lookups   { 0 };
+        /// Number of cache hits
+        unsigned long                         hits      { 0 };
+      } m_volumeCache;
+
+      /// Resolve the volume ID of a touchable using the last-volume cache if enabled
+      VolumeID touchableVolumeID(const G4VTouchable* touchable);
+
+      /// Index of the per track contributions of the hits in this event: key(hit, track) -> index in truth
+      Geant4HashTable<std::size_t> m_truthIndex;
+
     protected:
       /// Property: Hit creation mode. Maybe one of the enum HitCreationFlags
       int  m_hitCreationMode                  {       0 };
@@ -141,6 +200,20 @@ namespace dd4hep {
       bool m_useVolumeManager                 {    true };
       /// Property: Debug/Print Cell IDs in functions cellID(), volumeID()
       bool m_debugVolumeID                    {   false };
+      /// Property: Cache the volume ID of the last touchable in functions cellID(), volumeID()
+      bool m_useVolumeCache                   {   false };
+      /// Property: Expected number of hits per event. Reserves the key map of keyed hit collections
+      long m_expectedHits                     {       0 };
+      /// Property: Monte Carlo truth mode of calorimeter hits. Maybe one of the enum TruthModes
+      int  m_truthMode                        { TRUTH_ALL };
+      /// Property: Maximal number of track contributions per hit in mode TRUTH_TOP_N
+      /** The track contribution with the smallest deposit is summed into the first entry,
+       *  which keeps the track identifier of the first dropped track. Hence the sum of
+       *  the deposits is preserved and the entries stay valid for the output converters.
+       *  This is an approximation: a track dropped earlier, which contributes again,
+       *  starts a new entry and its earlier deposits stay in the summed entry.
+       */
+      int  m_truthMaxContributions            {      10 };
 
 #if defined(G__ROOT) || defined(__CLING__) || defined(__ROOTCLING__)
       /// Reference to the detector description object
@@ -184,6 +257,33 @@ namespace dd4hep {
         return m_useVolumeManager;
       }
 
+      /// Number of volume ID lookups in the last-volume cache
+      unsigned long volumeCacheLookups()  const  {
+        return m_volumeCache.lookups;
+      }
+
+      /// Number of volume ID lookups served by the last-volume cache
+      unsigned long volumeCacheHits()  const  {
+        return m_volumeCache.hits;
+      }
+
+      /// Property access to the Monte Carlo truth mode of calorimeter hits
+      int truthMode() const  {
+        return m_truthMode;
+      }
+
+      /// Add a Monte Carlo contribution to the truth record of a hit according to the truth mode
+      /** The hit pointer is only used as a key for the per track merging.
+       */
+      void addContribution(const void* hit,
+                           Geant4HitData::Contributions& truth,
+                           const Geant4HitData::Contribution& contrib);
+
+      /// Property access to the expected number of hits per event
+      std::size_t expectedHits() const  {
+        return m_expectedHits > 0 ? std::size_t(m_expectedHits) : 0;
+      }
+
       /// Property access to the hit creation mode
       int hitCreationMode() const  {
         return m_hitCreationMode;
@@ -335,6 +435,31 @@ namespace dd4hep {
       typedef std::pair<std::string, std::pair<Geant4Sensitive*,create_t> > HitCollection;
       typedef std::vector<HitCollection> HitCollections;
 
+      /// Fused filter chain evaluated on a step summary extracted once per step
+      /**
+       *  The terms of all filters are merged: the energy cuts to one cut,
+       *  the particle tests to lists of particle definitions. The cheapest
+       *  tests run first, generic filters last in their configured order.
+       */
+      struct FilterChain  {
+        /// Generic filters invoked by their operator()
+        std::vector<const Geant4Filter*>          generic;
+        /// Particles to be rejected
+        std::vector<const G4ParticleDefinition*>  reject;
+        /// Particles to be selected
+        std::vector<const G4ParticleDefinition*>  select;
+        /// Merged energy cut
+        double                                    cut      { 0e0 };
+        /// Flag if an energy cut is present
+        bool                                      haveCut  { false };
+        /// Flag if the chain is built
+        bool                                      valid    { false };
+
+        /// Evaluate the chain on the step summary
+        template <typename T>
+        bool operator()(const T* step, double edep, const G4ParticleDefinition* def)  const;
+      };
+
     protected:
       /// Geant4 hit collection context
       G4HCofThisEvent*        m_hce  { nullptr };
@@ -350,6 +475,10 @@ namespace dd4hep {
       Actors<Geant4Sensitive> m_actors;
       /// The list of sensitive detector filter objects
       Actors<Geant4Filter>    m_filters;
+      /// Fused filter chain built from the filter objects at the begin of the first event
+      FilterChain             m_filterChain;
+      /// Property: Flag to evaluate the filters as fused filter chain
+      bool                    m_fuseFilters  { true };
 
       /// Hit collection creators
       HitCollections          m_collections;
@@ -395,6 +524,11 @@ namespace dd4hep {
         return defineCollection(owner, coll_name, Geant4SensDetActionSequence::_create<TYPE>);
       }
 
+      /// Access the hit collection creators
+      const HitCollections& collections() const  {
+        return m_collections;
+      }
+
       /// Access HitCollection container names
       const std::string& hitCollectionName(std::size_t which) const;
 
@@ -433,6 +567,9 @@ namespace dd4hep {
       /// Add an actor responding to all callbacks. Sequence takes ownership.
       void adoptFilter(Geant4Action* filter);
 
+      /// Build the fused filter chain from the filter objects
+      void buildFilterChain();
+
       /// Callback before hit processing starts. Invoke all filters.
       bool accept(const G4Step* step) const;
 
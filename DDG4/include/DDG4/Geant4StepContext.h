@@ -0,0 +1,179 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+#ifndef DDG4_GEANT4STEPCONTEXT_H
+#define DDG4_GEANT4STEPCONTEXT_H
+
+// Framework include files
+#include <DD4hep/Volumes.h>
+
+// Geant4 include files
+#include <G4Step.hh>
+#include <G4Track.hh>
+#include <G4ThreeVector.hh>
+
+// Forward declarations
+class G4VTouchable;
+class G4VSensitiveDetector;
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Per thread cache of quantities derived from the current G4Step
+    /**
+     *  Within one step several actions need the same derived quantities:
+     *  every sensitive action of a sequence computes the step midpoint,
+     *  the volume and the cell identifier, the particle handler inspects
+     *  the sensitive detector of the volume etc.
+     *
+     *  The context is attached to the step by the sensitive detector
+     *  sequences and the stepping action sequence. Quantities are computed
+     *  on first request and reused by all further clients of the same step.
+     *  A step is identified by the G4Step object, the track, the track
+     *  identifier and the step number of the track. Geant4 reuses the G4Step
+     *  object and the memory of deleted tracks, hence the pointers alone do
+     *  not detect a new step. The stepping action sequence invalidates the
+     *  context once all actions of the step are done, the event action
+     *  sequence at the beginning of every event.
+     *
+     *  The context is thread local and never allocates memory.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class Geant4StepContext  {
+    public:
+      /// Sensitive detector type flags of a volume
+      enum SensitiveType  {
+        SD_NONE        = 0,
+        SD_TRACKER     = 1,
+        SD_CALORIMETER = 2
+      };
+
+    private:
+      enum  {
+        MIDPOINT  = 1<<0,
+        VOLUMEID  = 1<<1,
+        CELLID    = 1<<2
+      };
+      /// Current step
+      const G4Step*   m_step        { nullptr };
+      /// Track of the current step
+      const G4Track*  m_track       { nullptr };
+      /// Identifier of the track of the current step
+      int             m_trackID     { -1 };
+      /// Step number of the track of the current step
+      int             m_stepNumber  { -1 };
+      /// Flags of the valid cached quantities
+      unsigned int    m_valid       { 0 };
+      /// Midpoint of the step in Geant4 units
+      G4ThreeVector   m_midpointG4  { };
+      /// Chord length of the step in Geant4 units
+      double          m_length      { 0e0 };
+      /// Volume identifier of the pre-step touchable
+      VolumeID        m_volumeID    { 0 };
+      /// Cell identifier and the segmentation it was computed with
+      VolumeID        m_cellID      { 0 };
+      const void*     m_cellSegmentation { nullptr };
+      /// Sensitive type of the last sensitive detector asked for
+      const G4VSensitiveDetector* m_typeSD { nullptr };
+      int             m_typeSDFlags { SD_NONE };
+
+      /// Compute the midpoint and the chord length
+      void computeMidpoint();
+
+    public:
+      /// Default constructor
+      Geant4StepContext() = default;
+      /// No copy constructor
+      Geant4StepContext(const Geant4StepContext& copy) = delete;
+      /// No assignment
+      Geant4StepContext& operator=(const Geant4StepContext& copy) = delete;
+
+      /// Access the context of the current thread
+      static Geant4StepContext& instance();
+      /// Access the context of the current thread attached to the given step
+      static Geant4StepContext& get(const G4Step* step)  {
+        Geant4StepContext& ctxt = instance();
+        ctxt.attach(step);
+        return ctxt;
+      }
+
+      /// Attach the context to a step. Invalidates the cache if the step changed
+      void attach(const G4Step* step)  {
+        const G4Track* track = step->GetTrack();
+        int number = track->GetCurrentStepNumber();
+        int id     = track->GetTrackID();
+        if ( step != m_step || track != m_track || id != m_trackID || number != m_stepNumber )  {
+          m_step       = step;
+          m_track      = track;
+          m_trackID    = id;
+          m_stepNumber = number;
+          m_valid      = 0;
+        }
+      }
+      /// Invalidate the cache, e.g. when the step was modified or all clients are done
+      void reset()  {
+        m_step       = nullptr;
+        m_track      = nullptr;
+        m_trackID    = -1;
+        m_stepNumber = -1;
+        m_valid      = 0;
+      }
+      /// Access the current step
+      const G4Step* step()  const  {
+        return m_step;
+      }
+
+      /// Step midpoint in Geant4 units
+      const G4ThreeVector& midpointG4()  {
+        if ( !(m_valid & MIDPOINT) ) computeMidpoint();
+        return m_midpointG4;
+      }
+      /// Chord length between pre- and post-step point in Geant4 units
+      double chordLength()  {
+        if ( !(m_valid & MIDPOINT) ) computeMidpoint();
+        return m_length;
+      }
+
+      /// Cached volume identifier of the pre-step touchable. False if not yet computed
+      bool volumeID(VolumeID& id)  {
+        if ( !(m_valid & VOLUMEID) ) return false;
+        id = m_volumeID;
+        return true;
+      }
+      /// Store the volume identifier of the pre-step touchable
+      void setVolumeID(VolumeID id)  {
+        m_volumeID = id;
+        m_valid   |= VOLUMEID;
+      }
+      /// Cached cell identifier computed with the given segmentation. False if not yet computed
+      bool cellID(const void* segmentation, VolumeID& id)  {
+        if ( !(m_valid & CELLID) || segmentation != m_cellSegmentation ) return false;
+        id = m_cellID;
+        return true;
+      }
+      /// Store the cell identifier computed with the given segmentation
+      void setCellID(const void* segmentation, VolumeID id)  {
+        m_cellSegmentation = segmentation;
+        m_cellID  = id;
+        m_valid  |= CELLID;
+      }
+
+      /// Sensitive type flags of a sensitive detector (see SensitiveType)
+      int sensitiveType(const G4VSensitiveDetector* sd);
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+#endif // DDG4_GEANT4STEPCONTEXT_H
@@ -62,6 +62,13 @@ namespace dd4hep {
       /// Property: Flag to dump all sensitives after the conversion procedure
       bool m_printSensitives        { false };
 
+      /// Property: Number of threads for the parallel parts of the geometry conversion
+      int  m_numThreads             {     0 };
+      /// Property: Minimal number of regularly placed identical daughters to be parameterised (0: disabled)
+      int  m_detectReplicas         {     0 };
+      /// Property: Release the conversion-only maps of the geometry info after the construction
+      bool m_freezeGeometryInfo     { false };
+
       /// Property: Printout level of info object
       int  m_geoInfoPrintLevel;
       /// Property: G4 GDML dump file name (default: empty. If non empty, dump)
@@ -85,6 +92,8 @@ namespace dd4hep {
       int printMaterial(const char* mat_name);
 
       std::pair<std::string, PlacedVolume> resolve_path(const char* vol_path)   const;
+      /// Check that the placements are still mapped. Prints an error if the geometry info is frozen
+      bool check_placements(const char* command)   const;
       void printG4(const std::string& prefix, const G4VPhysicalVolume* g4pv)  const;
 
     public:
@@ -152,6 +161,9 @@ Geant4DetectorGeometryConstruction::Geant4DetectorGeometryConstruction(Geant4Con
   declareProperty("PrintPlacements",   m_printPlacements);
   declareProperty("PrintSensitives",   m_printSensitives);
   declareProperty("GeoInfoPrintLevel", m_geoInfoPrintLevel = DEBUG);
+  declareProperty("NumberOfThreads",   m_numThreads);
+  declareProperty("DetectReplicas",    m_detectReplicas);
+  declareProperty("FreezeGeometryInfo",m_freezeGeometryInfo);
 
   declareProperty("DumpHierarchy",     m_dumpHierarchy);
   declareProperty("DumpGDML",          m_dumpGDML="");
@@ -179,6 +191,8 @@ void Geant4DetectorGeometryConstruction::constructGeo(Geant4DetectorConstruction
   conv.debugLimits      = m_debugLimits;
   conv.printPlacements  = m_printPlacements;
   conv.printSensitives  = m_printSensitives;
+  conv.numThreads       = m_numThreads;
+  conv.detectReplicas   = m_detectReplicas;
 
   ctxt->geometry = conv.create(world).detach();
   ctxt->geometry->printLevel = outputLevel();
@@ -189,6 +203,7 @@ void Geant4DetectorGeometryConstruction::constructGeo(Geant4DetectorConstruction
   // Create Geant4 volume manager only if not yet available
   g4map.debugVolManager = m_debugVolManager;
   g4map.haveVolManager  = m_haveVolManager;
+  g4map.freezeGeometry  = m_freezeGeometryInfo;
   if( m_haveVolManager )  {
     g4map.volumeManager();
   }
@@ -218,6 +233,16 @@ Geant4DetectorGeometryConstruction::resolve_path(const char* vol_path)  const {
   return make_pair(p,pv);
 }
 
+/// Check that the placements are still mapped
+bool Geant4DetectorGeometryConstruction::check_placements(const char* command)  const {
+  const Geant4GeometryInfo* info = Geant4Mapping::instance().ptr();
+  if ( info && info->frozen )   {
+    error("+++ %s: The geometry info is frozen and the placements are released. [Ignored]", command);
+    return false;
+  }
+  return true;
+}
+
 /// Print geant4 material
 int Geant4DetectorGeometryConstruction::printMaterial(const char* mat_name)  {
   if ( mat_name )   {
@@ -332,6 +357,9 @@ int Geant4DetectorGeometryConstruction::printVolumeObj(const char* vol_path, Pla
 
 /// Print geant4 volume
 int Geant4DetectorGeometryConstruction::printVolume(const char* vol_path)  {
+  if ( !check_placements("printVolume") )   {
+    return 0;
+  }
   if ( vol_path )   {
     auto physVol = resolve_path(vol_path);
     if ( physVol.second.isValid() )    {
@@ -344,6 +372,9 @@ int Geant4DetectorGeometryConstruction::printVolume(const char* vol_path)  {
 
 /// Print geant4 volume
 int Geant4DetectorGeometryConstruction::printVolumeTree(const char* vol_path)  {
+  if ( !check_placements("printVolumeTree") )   {
+    return 0;
+  }
   if ( vol_path )   {
     auto [p, pv] = resolve_path(vol_path);
     if ( pv.isValid() )    {
@@ -364,6 +395,9 @@ int Geant4DetectorGeometryConstruction::printVolumeTree(const char* vol_path)  {
 }
 
 int Geant4DetectorGeometryConstruction::printVolTree(const char* vol_path)  {
+  if ( !check_placements("printTree") )   {
+    return 0;
+  }
   if ( vol_path )   {
     auto [p, pv] = resolve_path(vol_path);
     if ( pv.isValid() )    {
@@ -456,6 +490,9 @@ void Geant4DetectorGeometryConstruction::printG4(const std::string& prefix, cons
 }
 
 int Geant4DetectorGeometryConstruction::printG4Tree(const char* vol_path)  {
+  if ( !check_placements("printG4Tree") )   {
+    return 0;
+  }
   if ( vol_path )   {
     auto [p, pv] = resolve_path(vol_path);
     if ( pv.isValid() )    {
@@ -37,6 +37,8 @@ namespace dd4hep {
     namespace HepMC {
       /// HepMC EventStream class used internally by the Geant4EventReaderHepMC plugin
       class EventStream;
+      /// Memory mapped HepMC input file used internally by the Geant4EventReaderHepMC plugin
+      class MappedFile;
     }
 
     /// Class to populate Geant4 primaries from HepMC(2) files.
@@ -56,9 +58,19 @@ namespace dd4hep {
       typedef boost::iostreams::stream<dd4hep_file_source<int> > in_stream;
       //typedef boost::iostreams::stream<dd4hep_file_source<TFile*> > in_stream;
       typedef HepMC::EventStream EventStream;
+      typedef HepMC::MappedFile  MappedFile;
     protected:
       in_stream    m_input;
       EventStream* m_events;
+      /// Memory mapped input file if the parameter MemoryMap is set
+      MappedFile*  m_mapped    { nullptr };
+      /// Name of the event index file (optional)
+      std::string  m_indexFile { };
+      /// Flag to memory map the input file
+      bool         m_memoryMap { false };
+
+      /// Map the input file and build or load the event index
+      void mapInput();
     public:
       /// Initializing constructor
       explicit Geant4EventReaderHepMC(const std::string& nam);
@@ -70,6 +82,8 @@ namespace dd4hep {
                                               std::vector<Particle*>& particles)  override;
       virtual EventReaderStatus moveToEvent(int event_number)  override;
       virtual EventReaderStatus skipEvent() override { return EVENT_READER_OK; }
+      /// Set the parameters for the class
+      virtual EventReaderStatus setParameters(std::map< std::string, std::string >& parameters)  override;
 
     };
   }     /* End namespace sim   */
@@ -92,7 +106,14 @@ namespace dd4hep {
 // C/C++ include files
 #include <cerrno>
 #include <climits>
+#include <cstring>
+#include <fstream>
+#include <charconv>
 #include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 using namespace dd4hep::sim;
 using PropertyMask = dd4hep::detail::ReferenceBitMask<int>;
@@ -150,6 +171,8 @@ namespace dd4hep {
         typedef std::map<int,Geant4Particle*> Particles;
 
         std::istream& instream;
+        /// Memory mapped input. If set it replaces the input stream
+        MappedFile*   mapped { nullptr };
 
         // io information
         std::string key;
@@ -178,16 +201,107 @@ namespace dd4hep {
         void clear();
       };
 
+      /// Single line of a memory mapped HepMC file
+      /*
+       *  Implements the subset of the std::istringstream interface used to
+       *  parse HepMC records. Numbers are converted with std::from_chars
+       *  directly from the mapped bytes.
+       *
+       *  \author  M.Frank
+       *  \version 1.0
+       *  \ingroup DD4HEP_SIMULATION
+       */
+      class MappedLine  {
+        const char* m_begin { nullptr };
+        const char* m_ptr   { nullptr };
+        const char* m_end   { nullptr };
+        bool        m_fail  { false };
+        bool        m_eof   { false };
+
+        /// Skip white space. Returns false and sets the failure flags at the end of the line
+        bool skip_space();
+        /// Convert the next token to a number
+        template <typename T> MappedLine& number(T& value);
+      public:
+        /// Attach the line [begin, end)
+        void assign(const char* b, const char* e)
+        { m_begin = m_ptr = b; m_end = e; m_fail = m_eof = false; }
+        /// Reset the state flags
+        void clear()                       {  m_fail = m_eof = false;  }
+        bool fail()  const                 {  return m_fail;           }
+        bool eof()  const                  {  return m_eof;            }
+        bool operator!()  const            {  return m_fail;           }
+        explicit operator bool()  const    {  return !m_fail;          }
+        /// Length of the line
+        std::size_t size()  const          {  return m_end - m_begin;  }
+        /// Access a character of the line
+        char operator[](std::size_t i)  const  {  return m_begin[i];  }
+        /// Copy of the full line
+        std::string str()  const           {  return std::string(m_begin, m_end);  }
+        MappedLine& operator>>(int& value)    {  return number(value);  }
+        MappedLine& operator>>(long& value)   {  return number(value);  }
+        MappedLine& operator>>(float& value)  {  return number(value);  }
+        MappedLine& operator>>(double& value) {  return number(value);  }
+        MappedLine& operator>>(std::string& value);
+      };
+
+      /// Memory mapped HepMC file
+      /*
+       *  Implements the subset of the std::istream interface used to
+       *  read HepMC records and keeps the offsets of all event records.
+       *
+       *  \author  M.Frank
+       *  \version 1.0
+       *  \ingroup DD4HEP_SIMULATION
+       */
+      class MappedFile  {
+      public:
+        const char*        begin   { nullptr };
+        const char*        end     { nullptr };
+        const char*        cursor  { nullptr };
+        std::size_t        length  { 0 };
+        std::ios::iostate  state   { std::ios::goodbit };
+        /// Offsets of the event records
+        std::vector<std::size_t> events;
+
+        /// Initializing constructor: map the file
+        explicit MappedFile(const std::string& file_name);
+        /// Default destructor: unmap the file
+        ~MappedFile();
+        bool good()  const                 {  return state == std::ios::goodbit;   }
+        bool eof()  const                  {  return (state & std::ios::eofbit) != 0;  }
+        bool fail()  const                 {  return (state & (std::ios::failbit|std::ios::badbit)) != 0;  }
+        bool operator!()  const            {  return fail();           }
+        explicit operator bool()  const    {  return !fail();          }
+        void clear(std::ios::iostate s = std::ios::goodbit)  {  state = s;  }
+        /// Next character without extraction
+        int peek();
+        /// Position the cursor at the offset
+        void seek(std::size_t offset)      {  cursor = begin + offset; state = std::ios::goodbit;  }
+        /// Attach the next line to the tokenizer and advance the cursor
+        bool getline(MappedLine& line);
+        /// Collect the offsets of all event records
+        void build_index();
+        /// Load the event offsets from file. Returns false if the file is missing or stale
+        bool load_index(const std::string& file_name);
+        /// Save the event offsets to file
+        bool save_index(const std::string& file_name)  const;
+      };
+
       char get_input(std::istream& is, std::istringstream& iline);
+      char get_input(MappedFile& is, MappedLine& iline);
       int read_until_event_end(std::istream & is);
-      int read_weight_names(EventStream &, std::istringstream& iline);
-      int read_particle(EventStream &info, std::istringstream& iline, Geant4Particle * p);
-      int read_vertex(EventStream &info, std::istream& is, std::istringstream & iline);
-      int read_event_header(EventStream &info, std::istringstream & input, EventHeader& header);
-      int read_cross_section(EventStream &info, std::istringstream & input);
-      int read_units(EventStream &info, std::istringstream & input);
-      int read_heavy_ion(EventStream &, std::istringstream & input);
-      int read_pdf(EventStream &, std::istringstream & input);
+      int read_until_event_end(MappedFile & is);
+      template <typename INPUT> int read_weight_names(EventStream &, INPUT& iline);
+      template <typename INPUT> int read_particle(EventStream &info, INPUT& iline, Geant4Particle * p);
+      template <typename STREAM, typename INPUT>
+      int read_vertex(EventStream &info, STREAM& is, INPUT & iline);
+      template <typename INPUT> int read_event_header(EventStream &info, INPUT & input, EventHeader& header);
+      template <typename INPUT> int read_cross_section(EventStream &info, INPUT & input);
+      template <typename INPUT> int read_units(EventStream &info, INPUT & input);
+      template <typename INPUT> int read_heavy_ion(EventStream &, INPUT & input);
+      template <typename INPUT> int read_pdf(EventStream &, INPUT & input);
+      template <typename STREAM, typename INPUT> bool read_event(EventStream &info, STREAM& instream);
       Geant4Vertex* vertex(EventStream& info, int i);
       void fix_particles(EventStream &info);
     }
@@ -214,13 +328,68 @@ Geant4EventReaderHepMC::Geant4EventReaderHepMC(const std::string& nam)
 Geant4EventReaderHepMC::~Geant4EventReaderHepMC()    {
   delete m_events;
   m_events = 0;
+  delete m_mapped;
+  m_mapped = 0;
   m_input.close();
 }
 
+/// Set the parameters for the class
+Geant4EventReader::EventReaderStatus
+Geant4EventReaderHepMC::setParameters(std::map< std::string, std::string >& parameters)  {
+  _getParameterValue(parameters, "MemoryMap", m_memoryMap, false);
+  _getParameterValue(parameters, "IndexFile", m_indexFile, std::string());
+  if ( m_memoryMap )   {
+    mapInput();
+  }
+  return EVENT_READER_OK;
+}
+
+/// Map the input file and build or load the event index
+void Geant4EventReaderHepMC::mapInput()   {
+  bool loaded = false;
+  m_mapped = new MappedFile(m_name);
+  if ( !m_indexFile.empty() )   {
+    loaded = m_mapped->load_index(m_indexFile);
+  }
+  if ( !loaded )   {
+    m_mapped->build_index();
+    if ( !m_indexFile.empty() && !m_mapped->save_index(m_indexFile) )   {
+      printout(WARNING,"EventReaderHepMC","+++ Failed to write event index file %s Error:%s.",
+               m_indexFile.c_str(), ::strerror(errno));
+    }
+  }
+  m_events->mapped = m_mapped;
+  // Process the file header up to the first event record to determine the I/O type
+  if ( !m_mapped->events.empty() )   {
+    const char* end = m_mapped->end;
+    m_mapped->end = m_mapped->begin + m_mapped->events.front();
+    m_events->read();
+    m_mapped->end = end;
+    m_mapped->seek(m_mapped->events.front());
+  }
+  m_directAccess = true;
+  printout(INFO,"EventReaderHepMC","+++ Mapped %ld bytes of %s: %ld events (index %s).",
+           long(m_mapped->length), m_name.c_str(), long(m_mapped->events.size()),
+           loaded ? m_indexFile.c_str() : "built");
+}
+
 /// skipEvents if required
 Geant4EventReader::EventReaderStatus
 Geant4EventReaderHepMC::moveToEvent(int event_number) {
-  if( m_currEvent < event_number && event_number != 0 ) {
+  if ( m_mapped )   {
+    const std::vector<std::size_t>& events = m_mapped->events;
+    if ( event_number < 0 || event_number > int(events.size()) )   {
+      printout(ERROR,"EventReaderHepMC::moveToEvent","Event %d out of range: file has %ld events",
+               event_number, long(events.size()));
+      return EVENT_READER_ERROR;
+    }
+    if ( event_number != m_currEvent )   {
+      // Past the last event the next read reports the end of file
+      m_mapped->seek(event_number < int(events.size()) ? events[event_number] : m_mapped->length);
+      m_currEvent = event_number;
+    }
+  }
+  else if( m_currEvent < event_number && event_number != 0 ) {
     printout(INFO,"EventReaderHepMC::moveToEvent","Current event:%d Skipping the next %d events",
              m_currEvent, event_number);
     while ( m_currEvent < event_number ) {
@@ -398,7 +567,169 @@ int HepMC::read_until_event_end(std::istream & is) {
   return 0;
 }
 
-int HepMC::read_weight_names(EventStream&, std::istringstream&)   {
+char HepMC::get_input(MappedFile& is, MappedLine& iline)  {
+  char value = is.peek();
+  if ( !is || !is.getline(iline) ) {        // make sure the stream is valid
+    std::cerr << "StreamHelpers: setting badbit." << std::endl;
+    is.clear(std::ios::badbit);
+    return -1;
+  }
+  std::string firstc;
+  if ( iline.size()>1 && iline[1] == ' ' ) iline >> firstc;
+  return iline ? value : -1;
+}
+
+int HepMC::read_until_event_end(MappedFile & is) {
+  MappedLine line;
+  while ( is ) {
+    char val = is.peek();
+    if( val == 'E' ) {  // next event
+      return 1;
+    }
+    is.getline(line);
+    if ( !is.good() ) return 0;
+  }
+  return 0;
+}
+
+/// Skip white space. Returns false and sets the failure flags at the end of the line
+bool HepMC::MappedLine::skip_space()   {
+  while ( m_ptr < m_end && ::isspace(*m_ptr) ) ++m_ptr;
+  if ( m_ptr == m_end )   {
+    m_fail = m_eof = true;
+    return false;
+  }
+  return true;
+}
+
+/// Convert the next token to a number
+template <typename T> HepMC::MappedLine& HepMC::MappedLine::number(T& value)   {
+  if ( !m_fail && skip_space() )   {
+    const char* ptr = (*m_ptr == '+') ? m_ptr + 1 : m_ptr;
+    auto res = std::from_chars(ptr, m_end, value);
+    if ( res.ec != std::errc() )   {
+      value  = T(0);
+      m_fail = true;
+      return *this;
+    }
+    m_ptr = res.ptr;
+    m_eof = m_ptr == m_end;
+  }
+  return *this;
+}
+
+/// Extract the next white space delimited token
+HepMC::MappedLine& HepMC::MappedLine::operator>>(std::string& value)   {
+  if ( !m_fail && skip_space() )   {
+    const char* start = m_ptr;
+    while ( m_ptr < m_end && !::isspace(*m_ptr) ) ++m_ptr;
+    value.assign(start, m_ptr);
+    m_eof = m_ptr == m_end;
+  }
+  return *this;
+}
+
+/// Initializing constructor: map the file
+HepMC::MappedFile::MappedFile(const std::string& file_name)   {
+  struct stat buff;
+  int fd = ::open(file_name.c_str(), O_RDONLY);
+  if ( fd < 0 || ::fstat(fd, &buff) != 0 )   {
+    if ( fd >= 0 ) ::close(fd);
+    except("HepMC","+++ Failed to open input file: %s Error:%s.", file_name.c_str(), ::strerror(errno));
+  }
+  length = buff.st_size;
+  if ( length > 0 )   {
+    void* ptr = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    if ( ptr == MAP_FAILED )   {
+      ::close(fd);
+      except("HepMC","+++ Failed to map input file: %s Error:%s.", file_name.c_str(), ::strerror(errno));
+    }
+    ::madvise(ptr, length, MADV_SEQUENTIAL);
+    begin = (const char*)ptr;
+  }
+  ::close(fd);
+  cursor = begin;
+  end    = begin + length;
+}
+
+/// Default destructor: unmap the file
+HepMC::MappedFile::~MappedFile()   {
+  if ( begin ) ::munmap((void*)begin, length);
+}
+
+/// Next character without extraction
+int HepMC::MappedFile::peek()   {
+  if ( state != std::ios::goodbit )   {
+    state |= std::ios::failbit;
+    return EOF;
+  }
+  else if ( cursor >= end )   {
+    state |= std::ios::eofbit;
+    return EOF;
+  }
+  return *cursor;
+}
+
+/// Attach the next line to the tokenizer and advance the cursor
+bool HepMC::MappedFile::getline(MappedLine& line)   {
+  if ( state != std::ios::goodbit || cursor >= end )   {
+    state |= std::ios::eofbit|std::ios::failbit;
+    return false;
+  }
+  const char* eol = (const char*)::memchr(cursor, '\n', end - cursor);
+  if ( eol )   {
+    line.assign(cursor, eol);
+    cursor = eol + 1;
+  }
+  else   {
+    line.assign(cursor, end);
+    cursor = end;
+    state |= std::ios::eofbit;
+  }
+  return true;
+}
+
+/// Collect the offsets of all event records
+void HepMC::MappedFile::build_index()   {
+  events.clear();
+  for( const char* ptr = begin; ptr < end; )   {
+    if ( *ptr == 'E' ) events.emplace_back(ptr - begin);
+    const char* eol = (const char*)::memchr(ptr, '\n', end - ptr);
+    if ( !eol ) break;
+    ptr = eol + 1;
+  }
+}
+
+/// Load the event offsets from file. Returns false if the file is missing or stale
+bool HepMC::MappedFile::load_index(const std::string& file_name)   {
+  std::ifstream in(file_name);
+  std::string   tag;
+  std::size_t   len = 0, num = 0;
+  if ( !(in >> tag >> len >> num) || tag != "HepMC2-index" || len != length )
+    return false;
+  events.clear();
+  events.reserve(num);
+  for( std::size_t i = 0, offset = 0; i < num; ++i )   {
+    if ( !(in >> offset) || offset >= length || begin[offset] != 'E' )   {
+      events.clear();
+      return false;
+    }
+    events.emplace_back(offset);
+  }
+  return true;
+}
+
+/// Save the event offsets to file
+bool HepMC::MappedFile::save_index(const std::string& file_name)  const   {
+  std::ofstream out(file_name);
+  out << "HepMC2-index " << length << " " << events.size() << std::endl;
+  for( std::size_t offset : events )
+    out << offset << "\n";
+  out.flush();
+  return out.good();
+}
+
+template <typename INPUT> int HepMC::read_weight_names(EventStream&, INPUT&)   {
 #if 0
   int HepMC::read_weight_names(EventStream& info, std::istringstream& iline)
     size_t name_size = 0;
@@ -431,7 +762,8 @@ int HepMC::read_weight_names(EventStream&, std::istringstream&)   {
   return 1;
 }
 
-int HepMC::read_particle(EventStream &info, std::istringstream& input, Geant4Particle * p)   {
+template <typename INPUT>
+int HepMC::read_particle(EventStream &info, INPUT& input, Geant4Particle * p)   {
   float ene = 0., theta = 0., phi = 0;
   int   size = 0, stat=0;
   PropertyMask status(p->status);
@@ -490,7 +822,8 @@ int HepMC::read_particle(EventStream &info, std::istringstream& input, Geant4Par
   return 1;
 }
 
-int HepMC::read_vertex(EventStream &info, std::istream& is, std::istringstream & input)    {
+template <typename STREAM, typename INPUT>
+int HepMC::read_vertex(EventStream &info, STREAM& is, INPUT & input)    {
   int id=0, dummy = 0, num_orphans_in=0, num_particles_out=0, weights_size=0;
   std::vector<float> weights;
   Geant4Vertex* v = new Geant4Vertex();
@@ -573,7 +906,8 @@ int HepMC::read_vertex(EventStream &info, std::istream& is, std::istringstream &
   return 1;
 }
 
-int HepMC::read_event_header(EventStream &info, std::istringstream & input, EventHeader& header)   {
+template <typename INPUT>
+int HepMC::read_event_header(EventStream &info, INPUT & input, EventHeader& header)   {
   // read values into temp variables, then fill GenEvent
   int size = 0;
   input >> header.id;
@@ -625,12 +959,14 @@ int HepMC::read_event_header(EventStream &info, std::istringstream & input, Even
   return 1;
 }
 
-int HepMC::read_cross_section(EventStream &info, std::istringstream & input)   {
+template <typename INPUT>
+int HepMC::read_cross_section(EventStream &info, INPUT & input)   {
   input >> info.xsection >> info.xsection_err;
   return input.fail() ? 0 : 1;
 }
 
-int HepMC::read_units(EventStream &info, std::istringstream & input)   {
+template <typename INPUT>
+int HepMC::read_units(EventStream &info, INPUT & input)   {
   if( info.io_type == gen )  {
     std::string mom, pos;
     input >> mom >> pos;
@@ -648,7 +984,8 @@ int HepMC::read_units(EventStream &info, std::istringstream & input)   {
   return input.fail() ? 0 : 1;
 }
 
-int HepMC::read_heavy_ion(EventStream &, std::istringstream & input)  {
+template <typename INPUT>
+int HepMC::read_heavy_ion(EventStream &, INPUT & input)  {
   // read values into temp variables, then create a new HeavyIon object
   int nh =0, np =0, nt =0, nc =0,
     neut = 0, prot = 0, nw =0, nwn =0, nwnw =0;
@@ -674,7 +1011,8 @@ int HepMC::read_heavy_ion(EventStream &, std::istringstream & input)  {
   return input.fail() ? 0 : 1;
 }
 
-int HepMC::read_pdf(EventStream &, std::istringstream & input)  {
+template <typename INPUT>
+int HepMC::read_pdf(EventStream &, INPUT & input)  {
   // read values into temp variables, then create a new PdfInfo object
   int id1 =0, id2 =0;
   double  x1 = 0., x2 = 0., scale = 0., pdf1 = 0., pdf2 = 0.;
@@ -712,6 +1050,13 @@ int HepMC::read_pdf(EventStream &, std::istringstream & input)  {
 
 /// Check if data stream is in proper state and has data
 bool HepMC::EventStream::ok()  const   {
+  if ( mapped )  {
+    if ( mapped->eof() || mapped->fail() )  {
+      mapped->clear(std::ios::badbit);
+      return false;
+    }
+    return true;
+  }
   // make sure the stream is good
   if ( instream.eof() || instream.fail() )  {
     instream.clear(std::ios::badbit);
@@ -725,16 +1070,23 @@ void HepMC::EventStream::clear()   {
   detail::releaseObjects(m_particles);
 }
 
+/// Read the next event from the input stream or the memory mapped file
 bool HepMC::EventStream::read()   {
-  EventStream& info = *this;
+  if ( mapped )
+    return read_event<MappedFile, MappedLine>(*this, *mapped);
+  return read_event<std::istream, std::istringstream>(*this, instream);
+}
+
+template <typename STREAM, typename INPUT>
+bool HepMC::read_event(EventStream& info, STREAM& instream)   {
   bool event_read = false;
+  INPUT input_line;
 
-  detail::releaseObjects(vertices());
-  detail::releaseObjects(particles());
+  detail::releaseObjects(info.vertices());
+  detail::releaseObjects(info.particles());
 
   while( instream.good() ) {
     char value = instream.peek();
-    std::istringstream input_line;
     if      ( value == 'E' && event_read )
       break;
     else if ( instream.eof() && event_read )
@@ -758,20 +1110,20 @@ bool HepMC::EventStream::read()   {
       input_line >> key_value;
       // search for event listing key before first event only.
       key_value = key_value.substr(0,key_value.find('\r'));
-      if ( key_value == "H" && (this->io_type == gen || this->io_type == extascii) ) {
+      if ( key_value == "H" && (info.io_type == gen || info.io_type == extascii) ) {
         read_heavy_ion(info, input_line);
         break;
       }
       else if( key_value == "HepMC::IO_GenEvent-START_EVENT_LISTING" )
-        this->set_io(gen,key_value);
+        info.set_io(gen,key_value);
       else if( key_value == "HepMC::IO_Ascii-START_EVENT_LISTING" )
-        this->set_io(ascii,key_value);
+        info.set_io(ascii,key_value);
       else if( key_value == "HepMC::IO_ExtendedAscii-START_EVENT_LISTING" )
-        this->set_io(extascii,key_value);
+        info.set_io(extascii,key_value);
       else if( key_value == "HepMC::IO_Ascii-START_PARTICLE_DATA" )
-        this->set_io(ascii_pdt,key_value);
+        info.set_io(ascii_pdt,key_value);
       else if( key_value == "HepMC::IO_ExtendedAscii-START_PARTICLE_DATA" )
-        this->set_io(extascii_pdt,key_value);
+        info.set_io(extascii_pdt,key_value);
       else if( key_value == "HepMC::IO_GenEvent-END_EVENT_LISTING" )
         iotype = gen;
       else if( key_value == "HepMC::IO_Ascii-END_EVENT_LISTING" )
@@ -783,7 +1135,7 @@ bool HepMC::EventStream::read()   {
       else if( key_value == "HepMC::IO_ExtendedAscii-END_PARTICLE_DATA" )
         iotype = extascii_pdt;
 
-      if( iotype != 0 && this->io_type != iotype )  {
+      if( iotype != 0 && info.io_type != iotype )  {
         std::cerr << "GenEvent::find_end_key: iotype keys have changed. "
                   << "MALFORMED INPUT" << std::endl;
         instream.clear(std::ios::badbit);
@@ -795,7 +1147,7 @@ bool HepMC::EventStream::read()   {
       continue;
     }
     case 'E':           // deal with the event line
-      if ( !read_event_header(info, input_line, this->header) )
+      if ( !read_event_header(info, input_line, info.header) )
         goto Skip;
       event_read = true;
       continue;
@@ -834,9 +1186,9 @@ bool HepMC::EventStream::read()   {
     }
     continue;
   Skip:
-    printout(WARNING,"HepMC::EventStream","+++ Skip event with ID: %d",this->header.id);
-    detail::releaseObjects(vertices());
-    detail::releaseObjects(particles());
+    printout(WARNING,"HepMC::EventStream","+++ Skip event with ID: %d",info.header.id);
+    detail::releaseObjects(info.vertices());
+    detail::releaseObjects(info.particles());
     read_until_event_end(instream);
     event_read = false;
     if ( instream.eof() ) return false;
@@ -845,7 +1197,7 @@ bool HepMC::EventStream::read()   {
   if( not instream.good() ) return false;
  Done:
   fix_particles(info);
-  detail::releaseObjects(vertices());
+  detail::releaseObjects(info.vertices());
   return true;
 }
 
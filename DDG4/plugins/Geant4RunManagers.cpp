@@ -18,6 +18,7 @@
 
 /// Geant4 include files
 #include <G4RunManager.hh>
+#include <G4Version.hh>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -35,6 +36,8 @@ namespace dd4hep {
      *  Current specializations are:
      *  - G4RunManager for single threaded applications
      *  - G4MTRunManager for multi threaded applications
+     *  - G4TaskRunManager for task based applications (Geant4 >= 10.7)
+     *  - G4TaskRunManagerTBB for task based applications using the TBB backend
      *
      *  For convenience we name the factory instances according to the G4 classes.
      *
@@ -49,13 +52,16 @@ namespace dd4hep {
         : Geant4Action(ctxt, nam), RUNMANAGER()
       {
         declareProperty("NumberOfThreads", m_numThreads);
+        declareProperty("EventGrainsize",  m_eventGrainsize);
       }
       virtual ~Geant4RunManager()   { }
       /// Enable and install UI messenger
       virtual void enableUI();
     private:
-      /// global range cut for secondary productions
-      int m_numThreads;
+      /// Number of worker threads
+      int m_numThreads     { 0 };
+      /// Number of events per task (task based run managers only)
+      int m_eventGrainsize { 0 };
     };
     template <> void Geant4RunManager<G4RunManager>::enableUI()  {
       Geant4Action::enableUI();
@@ -94,4 +100,65 @@ namespace dd4hep {
 DD4HEP_PLUGINSVC_FACTORY(Geant4MTRunManager,G4MTRunManager,dd4hep::sim::Geant4Action*(_ns::CT*,std::string),__LINE__)
 #endif
 
+#if defined(G4MULTITHREADED) && G4VERSION_NUMBER >= 1070
+#include <G4TaskRunManager.hh>
+#ifdef DD4HEP_USE_TBB
+#include <tbb/global_control.h>
+#include <memory>
+#endif
 
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+    /// Task based run manager using the TBB backend of the Geant4 tasking library
+    /**
+     *  If DD4hep is built with TBB, the total parallelism of the process is
+     *  bounded to the number of worker threads (plus the master thread)
+     *  for the lifetime of the run manager. The Geant4 tasks, DDDigi and any
+     *  user TBB code then share one pool of threads instead of
+     *  oversubscribing the machine.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class G4TaskRunManagerTBB : public G4TaskRunManager   {
+    public:
+#ifdef DD4HEP_USE_TBB
+      /// Process wide limit of the TBB parallelism
+      std::unique_ptr<tbb::global_control> control;
+#endif
+      /// Default constructor
+      G4TaskRunManagerTBB() : G4TaskRunManager(nullptr, true, 0)  { }
+    };
+
+    template <> void Geant4RunManager<G4TaskRunManager>::enableUI()  {
+      Geant4Action::enableUI();
+      this->G4TaskRunManager::SetNumberOfThreads(m_numThreads);
+      if ( m_eventGrainsize > 0 )  {
+        this->G4TaskRunManager::SetGrainsize(m_eventGrainsize);
+      }
+      printout(WARNING,"Geant4RunManager","+++ Configured run manager of type: %s with %d threads.",
+               typeName(typeid(G4TaskRunManager)).c_str(), m_numThreads);
+    }
+    template <> void Geant4RunManager<G4TaskRunManagerTBB>::enableUI()  {
+      Geant4Action::enableUI();
+      this->G4TaskRunManager::SetNumberOfThreads(m_numThreads);
+      if ( m_eventGrainsize > 0 )  {
+        this->G4TaskRunManager::SetGrainsize(m_eventGrainsize);
+      }
+#ifdef DD4HEP_USE_TBB
+      this->control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism,
+                                                            std::size_t(m_numThreads+1));
+#endif
+      printout(WARNING,"Geant4RunManager","+++ Configured run manager of type: %s with %d threads.",
+               typeName(typeid(G4TaskRunManagerTBB)).c_str(), m_numThreads);
+    }
+    typedef Geant4RunManager<G4TaskRunManager>    Geant4TaskRunManager;
+    typedef Geant4RunManager<G4TaskRunManagerTBB> Geant4TaskRunManagerTBB;
+  }
+}
+DD4HEP_PLUGINSVC_FACTORY(Geant4TaskRunManager,G4TaskRunManager,dd4hep::sim::Geant4Action*(_ns::CT*,std::string),__LINE__)
+DD4HEP_PLUGINSVC_FACTORY(Geant4TaskRunManagerTBB,G4TaskRunManagerTBB,dd4hep::sim::Geant4Action*(_ns::CT*,std::string),__LINE__)
+#endif
@@ -34,7 +34,7 @@ namespace dd4hep {
                                  const HitContribution& contrib,
                                  Geant4HitCollection& coll,
                                  const HANDLER& h,
-                                 const Geant4Sensitive& sd,
+                                 Geant4Sensitive& sd,
                                  const Segmentation& segmentation)
       {
         typedef Geant4Calorimeter::Hit Hit;
@@ -81,7 +81,7 @@ namespace dd4hep {
             sd.except("+++ Invalid CELL ID for hit!");
           }
         }
-        hit->truth.emplace_back(contrib);
+        sd.addContribution(hit, hit->truth, contrib);
         hit->energyDeposit += contrib.deposit;
       }
     }
@@ -382,18 +382,19 @@ namespace dd4hep {
         Geant4HitCollection*  coll    = collection(m_collectionID);
         HitContribution       contrib = Hit::extractContribution(step);
         Position              pos     = h.prePos();
-        Hit* hit = coll->find<Hit>(PositionCompare<Hit,Position>(pos));
+        VolumeID              key     = hitPositionKey(pos);
+        Hit* hit = findHitByPosition<Hit>(*coll, pos, key);
         if ( !hit ) {
           hit = new Hit(pos);
           hit->cellID = volumeID(step);
-          coll->add(hit);
+          addHitByPosition(*coll, hit, key);
           if ( 0 == hit->cellID )  {
             hit->cellID = volumeID(step);
             except("+++ Invalid CELL ID for hit!");
           }
         }
         hit->energyDeposit += contrib.deposit;
-        hit->truth.emplace_back(contrib);
+        addContribution(hit, hit->truth, contrib);
         track->SetTrackStatus(fStopAndKill); // don't step photon any further
         mark(h.track);
         return true;
@@ -418,18 +419,19 @@ namespace dd4hep {
         Geant4HitCollection* coll = collection(m_collectionID);
         HitContribution   contrib = Hit::extractContribution(spot);
         Position          pos     = h.avgPosition();
-        Hit* hit = coll->find<Hit>(PositionCompare<Hit,Position>(pos));
+        VolumeID          key     = hitPositionKey(pos);
+        Hit* hit = findHitByPosition<Hit>(*coll, pos, key);
         if ( !hit ) {
           hit = new Hit(pos);
           hit->cellID = volumeID(h.touchable());
-          coll->add(hit);
+          addHitByPosition(*coll, hit, key);
           if ( 0 == hit->cellID )  {
             hit->cellID = volumeID(h.touchable());
             except("+++ Invalid CELL ID for hit!");
           }
         }
         hit->energyDeposit += contrib.deposit;
-        hit->truth.emplace_back(contrib);
+        addContribution(hit, hit->truth, contrib);
         mark(h.track);
         return true;
       }
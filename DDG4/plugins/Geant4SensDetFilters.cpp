@@ -82,6 +82,8 @@ namespace dd4hep {
       virtual bool operator()(const Geant4FastSimSpot* spot) const  override  final   {
         return !isSameType(getTrack(spot));
       }
+      /// Describe the filter as a term of a fused filter chain
+      virtual Term term() const  override  final;
     };
 
     /// Geant4 sensitive detector filter implementing a particle selector
@@ -103,6 +105,8 @@ namespace dd4hep {
       virtual bool operator()(const Geant4FastSimSpot* spot) const  override  final   {
         return isSameType(getTrack(spot));
       }
+      /// Describe the filter as a term of a fused filter chain
+      virtual Term term() const  override  final;
     };
 
     /// Geant4 sensitive detector filter implementing a Geantino rejector
@@ -124,6 +128,8 @@ namespace dd4hep {
       virtual bool operator()(const Geant4FastSimSpot* spot) const  override  final   {
         return !isGeantino(getTrack(spot));
       }
+      /// Describe the filter as a term of a fused filter chain
+      virtual Term term() const  override  final;
     };
 
     /// Geant4 sensitive detector filter implementing an energy cut.
@@ -148,6 +154,8 @@ namespace dd4hep {
       virtual bool operator()(const Geant4FastSimSpot* spot) const  override  final  {
         return spot->energy() > m_energyCut;
       }
+      /// Describe the filter as a term of a fused filter chain
+      virtual Term term() const  override  final;
     };
   }
 }
@@ -224,6 +232,15 @@ GeantinoRejectFilter::~GeantinoRejectFilter() {
   InstanceCount::decrement(this);
 }
 
+/// Describe the filter as a term of a fused filter chain
+Geant4Filter::Term GeantinoRejectFilter::term() const  {
+  Term t;
+  t.type = Term::REJECT_PARTICLE;
+  t.particles[0] = G4Geantino::Definition();
+  t.particles[1] = G4ChargedGeantino::Definition();
+  return t;
+}
+
 /// Constructor.
 ParticleRejectFilter::ParticleRejectFilter(Geant4Context* c, const std::string& n)
   : ParticleFilter(c,n) {
@@ -235,6 +252,14 @@ ParticleRejectFilter::~ParticleRejectFilter() {
   InstanceCount::decrement(this);
 }
 
+/// Describe the filter as a term of a fused filter chain
+Geant4Filter::Term ParticleRejectFilter::term() const  {
+  Term t;
+  t.type = Term::REJECT_PARTICLE;
+  t.particles[0] = definition();
+  return t;
+}
+
 /// Constructor.
 ParticleSelectFilter::ParticleSelectFilter(Geant4Context* c, const std::string& n)
   : ParticleFilter(c,n) {
@@ -246,6 +271,14 @@ ParticleSelectFilter::~ParticleSelectFilter() {
   InstanceCount::decrement(this);
 }
 
+/// Describe the filter as a term of a fused filter chain
+Geant4Filter::Term ParticleSelectFilter::term() const  {
+  Term t;
+  t.type = Term::SELECT_PARTICLE;
+  t.particles[0] = definition();
+  return t;
+}
+
 /// Constructor.
 EnergyDepositMinimumCut::EnergyDepositMinimumCut(Geant4Context* c, const std::string& n)
   : Geant4Filter(c,n) {
@@ -258,3 +291,11 @@ EnergyDepositMinimumCut::~EnergyDepositMinimumCut() {
   InstanceCount::decrement(this);
 }
 
+/// Describe the filter as a term of a fused filter chain
+Geant4Filter::Term EnergyDepositMinimumCut::term() const  {
+  Term t;
+  t.type = Term::ENERGY_CUT;
+  t.cut  = m_energyCut;
+  return t;
+}
+
@@ -0,0 +1,663 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+//
+// Please note:
+//
+// Frozen shower library for electromagnetic showers:
+//
+//  o Geant4ShowerLibraryWriter records the energy deposits of showers
+//    from full simulation relative to the point where the particle
+//    enters a region. The showers are binned in energy, |eta| and the
+//    material at the entry point.
+//
+//  o Geant4ShowerLibraryModel replaces showers in this region by a
+//    randomly chosen shower of the matching bin. The spots of the shower
+//    are scaled to the particle energy, rotated randomly around the
+//    particle direction and deposited through the G4FastSimHitMaker,
+//    so that the sensitive detectors of the region collect the hits.
+//
+//  The library file is memory mapped and shared by all threads.
+//
+//==========================================================================
+
+// Framework include files
+#include <DDG4/Geant4FastSimShowerModel.inl.h>
+#include <DDG4/Geant4SteppingAction.h>
+#include <DDG4/Geant4EventAction.h>
+#include <DDG4/Geant4RunAction.h>
+#include <DDG4/Geant4FastSimSpot.h>
+#include <DDG4/Geant4Random.h>
+#include <DD4hep/Printout.h>
+
+// Geant4 include files
+#include <G4Step.hh>
+#include <G4Track.hh>
+#include <G4StepPoint.hh>
+#include <G4Region.hh>
+#include <G4Material.hh>
+#include <G4FastStep.hh>
+#include <G4RegionStore.hh>
+#include <G4LogicalVolume.hh>
+#include <G4SystemOfUnits.hh>
+
+// C/C++ include files
+#include <map>
+#include <cmath>
+#include <tuple>
+#include <cerrno>
+#include <mutex>
+#include <memory>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep  {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim  {
+
+    /// Namespace of the shower library implementation
+    namespace shower_library  {
+
+      /// File header. All sections are 8 byte aligned
+      /**
+       *  Layout of the library file:
+       *  - Header
+       *  - double   energy bin edges [numEnergy+1]   (MeV)
+       *  - double   |eta| bin edges  [numEta+1]
+       *  - char     material names   [numMaterials][MATERIAL_NAME_LENGTH]
+       *  - uint64_t first shower of every bin [numBins+1], bin = (material*numEta + eta)*numEnergy + energy
+       *  - Shower   showers [numShowers]
+       *  - Spot     spots   [numSpots]
+       */
+      struct Header  {
+        char     magic[8];
+        uint32_t version;
+        uint32_t numEnergy;
+        uint32_t numEta;
+        uint32_t numMaterials;
+        uint64_t numShowers;
+        uint64_t numSpots;
+      };
+      /// Shower record: energy of the particle and range of spots
+      struct Shower  {
+        double   energy;
+        uint64_t firstSpot;
+        uint64_t numSpots;
+      };
+      /// Energy spot in the shower frame (mm): z along the particle direction
+      struct Spot  {
+        float x, y, z;
+        /// Deposited energy relative to the particle energy
+        float fraction;
+      };
+      static constexpr const char MAGIC[8] = { 'D','D','G','4','S','H','L','B' };
+      static constexpr uint32_t   VERSION  = 1;
+      static constexpr std::size_t MATERIAL_NAME_LENGTH = 64;
+
+      /// Bin definition common to the library reader and writer
+      class Binning  {
+      public:
+        std::vector<double>      energyEdges;
+        std::vector<double>      etaEdges;
+        std::vector<std::string> materials;
+
+        static int find(const std::vector<double>& edges, double value)  {
+          auto it = std::upper_bound(edges.begin(), edges.end(), value);
+          if ( it == edges.begin() || it == edges.end() ) return -1;
+          return int(it - edges.begin()) - 1;
+        }
+        std::size_t numBins()  const  {
+          return (energyEdges.size()-1) * (etaEdges.size()-1) * materials.size();
+        }
+        bool valid()  const  {
+          return energyEdges.size() > 1 && etaEdges.size() > 1 && !materials.empty();
+        }
+        /// Bin number of a shower. -1 if outside the library
+        long bin(double energy, double eta, int material)  const  {
+          int ie = find(energyEdges, energy);
+          int ih = find(etaEdges, std::abs(eta));
+          if ( ie < 0 || ih < 0 || material < 0 ) return -1;
+          return (long(material)*long(etaEdges.size()-1) + ih)*long(energyEdges.size()-1) + ie;
+        }
+        /// Index of a material. -1 if not part of the library
+        int material(const std::string& name)  const  {
+          auto it = std::find(materials.begin(), materials.end(), name);
+          return it == materials.end() ? -1 : int(it - materials.begin());
+        }
+      };
+
+      /// Read-only memory mapped shower library
+      class Library : public Binning  {
+      public:
+        std::string     fileName;
+        const char*     base       { nullptr };
+        std::size_t     length     { 0 };
+        const uint64_t* binStart   { nullptr };
+        const Shower*   showers    { nullptr };
+        const Spot*     spots      { nullptr };
+
+        /// Initializing constructor: map the file
+        explicit Library(const std::string& file_name);
+        /// Default destructor: unmap the file
+        ~Library();
+        /// Set the section pointers of the mapped file. Throws if the file is no valid library
+        void mapSections();
+        /// Access a library instance shared by all threads
+        static std::shared_ptr<const Library> load(const std::string& file_name);
+      };
+
+      /// Initializing constructor: map the file
+      Library::Library(const std::string& file_name) : fileName(file_name)  {
+        struct stat st;
+        int fd = ::open(file_name.c_str(), O_RDONLY);
+        if ( fd < 0 || ::fstat(fd, &st) != 0 )  {
+          if ( fd >= 0 ) ::close(fd);
+          except("Geant4ShowerLibrary", "+++ Failed to open shower library %s: %s",
+                 file_name.c_str(), std::strerror(errno));
+        }
+        length = st.st_size;
+        void* ptr = length > 0 ? ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+        ::close(fd);
+        if ( ptr == MAP_FAILED )  {
+          except("Geant4ShowerLibrary", "+++ Failed to map shower library %s: %s",
+                 file_name.c_str(), std::strerror(errno));
+        }
+        base = (const char*)ptr;
+        try  {
+          mapSections();
+        }
+        catch(...)  {
+          ::munmap((void*)base, length);
+          base = nullptr;
+          throw;
+        }
+        ::madvise((void*)base, length, MADV_RANDOM);
+        const Header* hdr = (const Header*)base;
+        printout(INFO, "Geant4ShowerLibrary",
+                 "+++ Mapped shower library %s: %ld showers with %ld spots in %ld bins [%ld MB]",
+                 file_name.c_str(), long(hdr->numShowers), long(hdr->numSpots),
+                 long(numBins()), long(length >> 20));
+      }
+
+      /// Set the section pointers of the mapped file. Throws if the file is no valid library
+      void Library::mapSections()  {
+        const Header* hdr = (const Header*)base;
+        if ( length < sizeof(Header) || ::memcmp(hdr->magic, MAGIC, sizeof(MAGIC)) != 0 || hdr->version != VERSION )  {
+          except("Geant4ShowerLibrary", "+++ %s is no shower library of version %u.", fileName.c_str(), VERSION);
+        }
+        std::size_t offset = sizeof(Header);
+        auto corrupted = [this](const char* reason)  {
+          except("Geant4ShowerLibrary", "+++ Shower library %s is corrupted: %s.", fileName.c_str(), reason);
+        };
+        /// Access the next section of the file with num entries of the given size
+        auto section = [this, &offset, &corrupted](uint64_t num, std::size_t size)  {
+          if ( num > (length - offset) / size )  {
+            corrupted("section exceeds the file size");
+          }
+          const char* ptr = base + offset;
+          offset += num * size;
+          return ptr;
+        };
+        const double* edges = (const double*)section(uint64_t(hdr->numEnergy) + 1, sizeof(double));
+        energyEdges.assign(edges, edges + hdr->numEnergy + 1);
+        edges = (const double*)section(uint64_t(hdr->numEta) + 1, sizeof(double));
+        etaEdges.assign(edges, edges + hdr->numEta + 1);
+        const char* names = section(hdr->numMaterials, MATERIAL_NAME_LENGTH);
+        for( uint32_t i = 0; i < hdr->numMaterials; ++i, names += MATERIAL_NAME_LENGTH )
+          materials.emplace_back(names, ::strnlen(names, MATERIAL_NAME_LENGTH));
+        if ( !valid() )  {
+          corrupted("no bins");
+        }
+        // The bin start section must fit into the file: this also excludes an overflow of numBins()
+        uint64_t max_bins = (length - offset) / sizeof(uint64_t);
+        uint64_t num_energy = energyEdges.size() - 1, num_eta = etaEdges.size() - 1;
+        if ( num_energy > max_bins / num_eta || num_energy * num_eta > max_bins / materials.size() )  {
+          corrupted("section exceeds the file size");
+        }
+        binStart = (const uint64_t*)section(numBins() + 1, sizeof(uint64_t));
+        showers  = (const Shower*)section(hdr->numShowers, sizeof(Shower));
+        spots    = (const Spot*)section(hdr->numSpots, sizeof(Spot));
+        if ( offset != length )  {
+          corrupted("inconsistent file size");
+        }
+        if ( binStart[0] != 0 || binStart[numBins()] != hdr->numShowers )  {
+          corrupted("inconsistent number of showers");
+        }
+        for( std::size_t i = 0; i < numBins(); ++i )  {
+          if ( binStart[i+1] < binStart[i] ) corrupted("invalid shower range of a bin");
+        }
+        for( uint64_t i = 0; i < hdr->numShowers; ++i )  {
+          const Shower& s = showers[i];
+          if ( s.firstSpot > hdr->numSpots || s.numSpots > hdr->numSpots - s.firstSpot )
+            corrupted("invalid spot range of a shower");
+        }
+      }
+
+      /// Default destructor: unmap the file
+      Library::~Library()  {
+        if ( base ) ::munmap((void*)base, length);
+      }
+
+      /// Access a library instance shared by all threads
+      std::shared_ptr<const Library> Library::load(const std::string& file_name)  {
+        static std::mutex lock;
+        static std::map<std::string, std::weak_ptr<const Library> > libraries;
+        std::lock_guard<std::mutex> guard(lock);
+        std::shared_ptr<const Library> lib = libraries[file_name].lock();
+        if ( !lib )  {
+          lib = std::make_shared<const Library>(file_name);
+          libraries[file_name] = lib;
+        }
+        return lib;
+      }
+
+      /// Shower collection of the library writer shared by all threads
+      class Collection : public Binning  {
+      public:
+        std::mutex                        lock;
+        std::vector<std::vector<Shower> > showers;
+        std::vector<std::vector<Spot> >   spots;
+        /// Number of writer instances in the current run
+        std::size_t                       activeWriters { 0 };
+
+        /// Access a collection instance shared by all threads
+        static std::shared_ptr<Collection> instance(const std::string& file_name);
+        /// Add shower to the collection
+        bool add(long bin, double energy, std::vector<Spot>&& shower_spots, std::size_t max_showers);
+        /// Register a writer instance for the current run
+        void beginRun();
+        /// Release a writer instance. The last instance finishing the run writes the library file
+        bool endRun(const std::string& file_name);
+        /// Write library file. Called with the lock held
+        bool write(const std::string& file_name);
+      };
+
+      /// Access a collection instance shared by all threads
+      std::shared_ptr<Collection> Collection::instance(const std::string& file_name)  {
+        static std::mutex lock;
+        static std::map<std::string, std::weak_ptr<Collection> > collections;
+        std::lock_guard<std::mutex> guard(lock);
+        std::shared_ptr<Collection> coll = collections[file_name].lock();
+        if ( !coll )  {
+          coll = std::make_shared<Collection>();
+          collections[file_name] = coll;
+        }
+        return coll;
+      }
+
+      /// Add shower to the collection
+      bool Collection::add(long bin, double energy, std::vector<Spot>&& shower_spots, std::size_t max_showers)  {
+        std::lock_guard<std::mutex> guard(lock);
+        if ( showers.empty() )  {
+          showers.resize(numBins());
+          spots.resize(numBins());
+        }
+        auto& bin_showers = showers[bin];
+        auto& bin_spots   = spots[bin];
+        if ( max_showers > 0 && bin_showers.size() >= max_showers )  {
+          return false;
+        }
+        bin_showers.emplace_back(Shower{ energy, bin_spots.size(), shower_spots.size() });
+        bin_spots.insert(bin_spots.end(), shower_spots.begin(), shower_spots.end());
+        return true;
+      }
+
+      /// Register a writer instance for the current run
+      void Collection::beginRun()  {
+        std::lock_guard<std::mutex> guard(lock);
+        ++activeWriters;
+      }
+
+      /// Release a writer instance. The last instance finishing the run writes the library file
+      bool Collection::endRun(const std::string& file_name)  {
+        std::lock_guard<std::mutex> guard(lock);
+        if ( activeWriters > 0 && --activeWriters > 0 )  {
+          return true;
+        }
+        return write(file_name);
+      }
+
+      /// Write library file. Called with the lock held
+      bool Collection::write(const std::string& file_name)  {
+        std::ofstream out(file_name, std::ios::binary|std::ios::trunc);
+        Header hdr;
+        std::size_t num_bins = numBins();
+        std::vector<uint64_t> bin_start(num_bins + 1, 0);
+
+        ::memcpy(hdr.magic, MAGIC, sizeof(MAGIC));
+        hdr.version      = VERSION;
+        hdr.numEnergy    = uint32_t(energyEdges.size() - 1);
+        hdr.numEta       = uint32_t(etaEdges.size() - 1);
+        hdr.numMaterials = uint32_t(materials.size());
+        hdr.numShowers   = 0;
+        hdr.numSpots     = 0;
+        for( std::size_t i = 0; i < showers.size(); ++i )  {
+          hdr.numShowers += showers[i].size();
+          hdr.numSpots   += spots[i].size();
+        }
+        for( std::size_t i = 0; i < num_bins; ++i )
+          bin_start[i+1] = bin_start[i] + (i < showers.size() ? showers[i].size() : 0);
+
+        out.write((const char*)&hdr, sizeof(hdr));
+        out.write((const char*)energyEdges.data(), energyEdges.size()*sizeof(double));
+        out.write((const char*)etaEdges.data(), etaEdges.size()*sizeof(double));
+        for( const auto& m : materials )  {
+          char name[MATERIAL_NAME_LENGTH] = { 0 };
+          ::strncpy(name, m.c_str(), MATERIAL_NAME_LENGTH-1);
+          out.write(name, MATERIAL_NAME_LENGTH);
+        }
+        out.write((const char*)bin_start.data(), bin_start.size()*sizeof(uint64_t));
+        uint64_t first_spot = 0;
+        for( std::size_t i = 0; i < showers.size(); ++i )  {
+          for( Shower s : showers[i] )  {
+            s.firstSpot += first_spot;
+            out.write((const char*)&s, sizeof(s));
+          }
+          first_spot += spots[i].size();
+        }
+        for( const auto& s : spots )
+          out.write((const char*)s.data(), s.size()*sizeof(Spot));
+        out.close();
+        if ( !out.good() )  {
+          printout(ERROR, "Geant4ShowerLibrary", "+++ Failed to write shower library %s", file_name.c_str());
+          return false;
+        }
+        printout(INFO, "Geant4ShowerLibrary", "+++ Wrote shower library %s: %ld showers with %ld spots.",
+                 file_name.c_str(), long(hdr.numShowers), long(hdr.numSpots));
+        return true;
+      }
+    }
+
+    ///===================================================================================================
+    ///
+    ///  Frozen shower library model (e+, e-, gamma)
+    ///
+    ///===================================================================================================
+
+    /// Configuration structure for the fast simulation shower model Geant4FSShowerModel<shower_library_model>
+    class shower_library_model  {
+    public:
+      G4FastSimHitMaker hitMaker         { };
+      /// Property: Name of the library file
+      std::string       libraryFile      { };
+      /// Property: Maximal energy of particles to be replaced by library showers
+      double            maxEnergy        { 1e0*GeV };
+      /// The memory mapped library
+      std::shared_ptr<const shower_library::Library> library;
+      /// Cache of the library material index of Geant4 materials
+      std::map<const G4Material*, int> materials;
+
+      /// Library bin of a track. -1 if the library has no showers for it
+      long bin(const G4Track* track)  {
+        const G4Material* mat = track->GetMaterial();
+        auto it = materials.find(mat);
+        if ( it == materials.end() )
+          it = materials.emplace(mat, library->material(mat->GetName())).first;
+        long b = library->bin(track->GetKineticEnergy(), track->GetMomentumDirection().eta(), it->second);
+        return (b >= 0 && library->binStart[b+1] > library->binStart[b]) ? b : -1;
+      }
+    };
+
+    /// Declare optional properties from embedded structure
+    template <>
+    void Geant4FSShowerModel<shower_library_model>::initialize()     {
+      declareProperty("LibraryFile", this->locals.libraryFile);
+      declareProperty("MaxEnergy",   this->locals.maxEnergy);
+      this->m_applicablePartNames.emplace_back("e+");
+      this->m_applicablePartNames.emplace_back("e-");
+      this->m_applicablePartNames.emplace_back("gamma");
+    }
+
+    /// Sensitive detector construction callback. Called at "ConstructSDandField()"
+    template <>
+    void Geant4FSShowerModel<shower_library_model>::constructSensitives(Geant4DetectorConstructionContext* ctxt)   {
+      this->locals.library = shower_library::Library::load(this->locals.libraryFile);
+      this->Geant4FastSimShowerModel::constructSensitives(ctxt);
+    }
+
+    /// User callback to determine if the shower creation should be triggered
+    template <>
+    bool Geant4FSShowerModel<shower_library_model>::check_trigger(const G4FastTrack& track)   {
+      const G4Track* primary = track.GetPrimaryTrack();
+      if ( primary->GetKineticEnergy() > this->locals.maxEnergy )
+        return false;
+      else if ( !this->Geant4FastSimShowerModel::check_trigger(track) )
+        return false;
+      return this->locals.bin(primary) >= 0;
+    }
+
+    /// User callback to model the particle/energy shower
+    template <>
+    void Geant4FSShowerModel<shower_library_model>::modelShower(const G4FastTrack& track, G4FastStep& step)   {
+      auto* primary = track.GetPrimaryTrack();
+      const auto& lib = *this->locals.library;
+      long   bin      = this->locals.bin(primary);
+      // Kill the parameterised particle:
+      this->killParticle(step, primary->GetKineticEnergy(), 0e0);
+      if ( bin < 0 )   {
+        return;
+      }
+      G4FastHit hit;
+      Geant4FastSimSpot spot(&hit, &track);
+      Geant4Random* rndm   = Geant4Random::instance();
+      double        energy = spot.kineticEnergy();
+      uint64_t      first  = lib.binStart[bin];
+      uint64_t      num    = lib.binStart[bin+1] - first;
+      const auto&   shower = lib.showers[first + std::min(uint64_t(rndm->rndm()*double(num)), num-1)];
+
+      // Axis of the shower in the global reference frame, randomly rotated around the direction
+      double        phi     = rndm->uniform(0e0, twopi);
+      G4ThreeVector zShower = primary->GetMomentumDirection();
+      G4ThreeVector xShower = zShower.orthogonal().unit().rotate(phi, zShower);
+      G4ThreeVector yShower = zShower.cross(xShower);
+      G4ThreeVector sShower = spot.trackPosition();
+      for( uint64_t i = 0; i < shower.numSpots; ++i )  {
+        const auto& s = lib.spots[shower.firstSpot + i];
+        hit.SetPosition(sShower + double(s.x)*xShower + double(s.y)*yShower + double(s.z)*zShower);
+        hit.SetEnergy(double(s.fraction) * energy);
+        this->locals.hitMaker.make(hit, track);
+      }
+    }
+
+    typedef Geant4FSShowerModel<shower_library_model> Geant4ShowerLibraryModel;
+
+    ///===================================================================================================
+    ///
+    ///  Shower library generation from full simulation
+    ///
+    ///===================================================================================================
+
+    /// Class to record electromagnetic showers from full simulation into a shower library
+    /**
+     *  A shower is recorded when a primary particle of the requested types
+     *  enters the region. All energy deposits inside the region are
+     *  accumulated in cubic cells of the shower frame until the end of the
+     *  event. Hence the library should be generated with single particle events.
+     *
+     *  In multi-threaded mode all threads fill the same library. The library
+     *  file is written at the end of every run by the last thread finishing
+     *  the run.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class Geant4ShowerLibraryWriter : public Geant4SteppingAction  {
+    protected:
+      typedef std::map<std::tuple<int,int,int>, double> Cells;
+      /// Property: Name of the library file
+      std::string              m_output;
+      /// Property: Name of the region to be parameterised
+      std::string              m_regionName;
+      /// Property: Names of the particles to be recorded
+      std::vector<std::string> m_particleNames { "e+", "e-", "gamma" };
+      /// Property: Energy bin edges
+      std::vector<double>      m_energyBins;
+      /// Property: |eta| bin edges
+      std::vector<double>      m_etaBins;
+      /// Property: Material names of the library
+      std::vector<std::string> m_materials;
+      /// Property: Cell size to merge energy deposits
+      double                   m_spotSize     { 1e0*mm };
+      /// Property: Maximal number of showers per bin (0: unlimited)
+      std::size_t              m_maxShowers   { 1000 };
+
+      /// Shared library collection
+      std::shared_ptr<shower_library::Collection> m_collection;
+      /// Reference to the Geant4 region
+      const G4Region*          m_region       { nullptr };
+      /// Current shower: library bin, origin, frame and energy
+      long                     m_bin          { -1 };
+      bool                     m_done         { false };
+      G4ThreeVector            m_origin, m_x, m_y, m_z;
+      double                   m_energy       { 0e0 };
+      /// Current shower: energy deposits
+      Cells                    m_cells;
+
+    public:
+      /// Standard constructor
+      Geant4ShowerLibraryWriter(Geant4Context* context, const std::string& nam);
+      /// Default destructor
+      virtual ~Geant4ShowerLibraryWriter() = default;
+      /// User stepping callback
+      virtual void operator()(const G4Step* step, G4SteppingManager* mgr)  override;
+      /// Begin-of-run callback
+      void beginRun(const G4Run* run);
+      /// Begin-of-event callback
+      void beginEvent(const G4Event* event);
+      /// End-of-event callback
+      void endEvent(const G4Event* event);
+      /// End-of-run callback
+      void endRun(const G4Run* run);
+    };
+
+    /// Standard constructor
+    Geant4ShowerLibraryWriter::Geant4ShowerLibraryWriter(Geant4Context* ctxt, const std::string& nam)
+      : Geant4SteppingAction(ctxt, nam)
+    {
+      declareProperty("Output",     m_output);
+      declareProperty("RegionName", m_regionName);
+      declareProperty("Particles",  m_particleNames);
+      declareProperty("EnergyBins", m_energyBins);
+      declareProperty("EtaBins",    m_etaBins);
+      declareProperty("Materials",  m_materials);
+      declareProperty("SpotSize",   m_spotSize);
+      declareProperty("MaxShowers", m_maxShowers);
+      eventAction().callAtBegin(this, &Geant4ShowerLibraryWriter::beginEvent);
+      eventAction().callAtEnd(this,   &Geant4ShowerLibraryWriter::endEvent);
+      runAction().callAtBegin(this,   &Geant4ShowerLibraryWriter::beginRun);
+      runAction().callAtEnd(this,     &Geant4ShowerLibraryWriter::endRun);
+    }
+
+    /// Begin-of-run callback
+    void Geant4ShowerLibraryWriter::beginRun(const G4Run* /* run */)   {
+      if ( !m_collection )  {
+        m_collection = shower_library::Collection::instance(m_output);
+        std::lock_guard<std::mutex> guard(m_collection->lock);
+        if ( !m_collection->valid() )  {
+          m_collection->energyEdges = m_energyBins;
+          m_collection->etaEdges    = m_etaBins;
+          m_collection->materials   = m_materials;
+          if ( !m_collection->valid() )  {
+            except("+++ Invalid shower library binning: %ld energy edges, %ld eta edges, %ld materials.",
+                   long(m_energyBins.size()), long(m_etaBins.size()), long(m_materials.size()));
+          }
+        }
+      }
+      m_collection->beginRun();
+    }
+
+    /// Begin-of-event callback
+    void Geant4ShowerLibraryWriter::beginEvent(const G4Event* /* event */)   {
+      if ( !m_region )  {
+        m_region = G4RegionStore::GetInstance()->GetRegion(m_regionName, false);
+        if ( !m_region )  {
+          except("+++ Unknown region: %s", m_regionName.c_str());
+        }
+      }
+      m_bin  = -1;
+      m_done = false;
+      m_cells.clear();
+    }
+
+    /// User stepping callback
+    void Geant4ShowerLibraryWriter::operator()(const G4Step* step, G4SteppingManager* /* mgr */)   {
+      const G4StepPoint* pre  = step->GetPreStepPoint();
+      const G4StepPoint* post = step->GetPostStepPoint();
+      if ( m_bin >= 0 )  {
+        double edep = step->GetTotalEnergyDeposit();
+        if ( edep > 0e0 && pre->GetPhysicalVolume()->GetLogicalVolume()->GetRegion() == m_region )  {
+          G4ThreeVector pos = 0.5*(pre->GetPosition() + post->GetPosition()) - m_origin;
+          auto key = std::make_tuple(int(std::floor(pos.dot(m_x)/m_spotSize)),
+                                     int(std::floor(pos.dot(m_y)/m_spotSize)),
+                                     int(std::floor(pos.dot(m_z)/m_spotSize)));
+          m_cells[key] += edep;
+        }
+        return;
+      }
+      else if ( m_done || post->GetStepStatus() != fGeomBoundary || !post->GetPhysicalVolume() )  {
+        return;
+      }
+      // Start recording when a primary particle enters the region
+      const G4Track* track = step->GetTrack();
+      if ( track->GetParentID() != 0 ||
+           post->GetPhysicalVolume()->GetLogicalVolume()->GetRegion() != m_region ||
+           pre->GetPhysicalVolume()->GetLogicalVolume()->GetRegion() == m_region )  {
+        return;
+      }
+      const std::string& particle = track->GetDefinition()->GetParticleName();
+      if ( std::find(m_particleNames.begin(), m_particleNames.end(), particle) == m_particleNames.end() )  {
+        return;
+      }
+      m_done   = true;
+      m_energy = post->GetKineticEnergy();
+      m_z      = post->GetMomentumDirection();
+      m_x      = m_z.orthogonal().unit();
+      m_y      = m_z.cross(m_x);
+      m_origin = post->GetPosition();
+      m_bin    = m_collection->bin(m_energy, m_z.eta(), m_collection->material(post->GetMaterial()->GetName()));
+    }
+
+    /// End-of-event callback
+    void Geant4ShowerLibraryWriter::endEvent(const G4Event* /* event */)   {
+      if ( m_bin >= 0 && !m_cells.empty() )  {
+        std::vector<shower_library::Spot> spots;
+        spots.reserve(m_cells.size());
+        for( const auto& c : m_cells )  {
+          spots.emplace_back(shower_library::Spot{ float((std::get<0>(c.first)+0.5)*m_spotSize),
+                                                   float((std::get<1>(c.first)+0.5)*m_spotSize),
+                                                   float((std::get<2>(c.first)+0.5)*m_spotSize),
+                                                   float(c.second/m_energy) });
+        }
+        m_collection->add(m_bin, m_energy, std::move(spots), m_maxShowers);
+      }
+      m_bin = -1;
+      m_cells.clear();
+    }
+
+    /// End-of-run callback
+    void Geant4ShowerLibraryWriter::endRun(const G4Run* /* run */)   {
+      if ( m_collection )  {
+        m_collection->endRun(m_output);
+      }
+    }
+  }
+}
+
+#include <DDG4/Factories.h>
+DECLARE_GEANT4ACTION_NS(dd4hep::sim,Geant4ShowerLibraryModel)
+DECLARE_GEANT4ACTION_NS(dd4hep::sim,Geant4ShowerLibraryWriter)
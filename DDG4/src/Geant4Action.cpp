@@ -64,6 +64,7 @@ Geant4Action::Geant4Action(Geant4Context* ctxt, const std::string& nam)
 
 /// Default destructor
 Geant4Action::~Geant4Action() {
+  Geant4ActionProfiler::detach(this);
   InstanceCount::decrement(this);
 }
 
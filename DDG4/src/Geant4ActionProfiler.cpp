@@ -0,0 +1,247 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+
+// Framework include files
+#include <DD4hep/Printout.h>
+#include <DD4hep/Primitives.h>
+#include <DDG4/Geant4Action.h>
+#include <DDG4/Geant4ActionProfiler.h>
+
+// C/C++ include files
+#include <map>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <fstream>
+#include <algorithm>
+#include <pthread.h>
+
+using namespace dd4hep::sim;
+
+int Geant4ActionProfiler::s_level = 0;
+
+namespace {
+  /// Registry of all statistics records
+  struct Registry  {
+    std::mutex lock;
+    std::vector<std::unique_ptr<Geant4ActionProfile> > records;
+    /// Calibration point of the timer
+    uint64_t start_ticks { 0 };
+    std::chrono::steady_clock::time_point start_time { };
+  };
+  Registry& registry()  {
+    // Never deleted: actions may be released after the static destructors ran
+    static Registry* r = new Registry();
+    return *r;
+  }
+  /// Statistics records of the calling thread by action instance
+  thread_local std::unordered_map<const Geant4Action*, Geant4ActionProfile*> s_threadRecords;
+
+  /// Statistics of all records of one action name and type
+  struct Summary  {
+    const Geant4ActionProfile* first { nullptr };
+    std::vector<const Geant4ActionProfile*> threads;
+    uint64_t calls { 0 }, ticks { 0 }, cpu { 0 }, maxTicks { 0 }, maxCpu { 0 };
+  };
+
+  /// Merge the records of all threads. Result is sorted by decreasing time
+  std::vector<Summary> summarize(const std::vector<std::unique_ptr<Geant4ActionProfile> >& records)  {
+    std::map<std::pair<std::string,std::string>, Summary> merged;
+    for( const auto& r : records )   {
+      if ( r->calls == 0 ) continue;
+      Summary& s = merged[std::make_pair(r->name, r->type)];
+      if ( !s.first ) s.first = r.get();
+      s.threads.emplace_back(r.get());
+      s.calls += r->calls;
+      s.ticks += r->ticks;
+      s.cpu   += r->cpu;
+      s.maxTicks = std::max(s.maxTicks, r->maxTicks);
+      s.maxCpu   = std::max(s.maxCpu,   r->maxCpu);
+    }
+    std::vector<Summary> result;
+    result.reserve(merged.size());
+    for( auto& m : merged ) result.emplace_back(std::move(m.second));
+    std::sort(result.begin(), result.end(), [](const Summary& a, const Summary& b) { return a.ticks > b.ticks; });
+    return result;
+  }
+
+  /// Write the non-empty head of a histogram as JSON array
+  void json_histogram(std::ostream& out, const uint64_t (&histogram)[Geant4ActionProfile::NUM_BINS])  {
+    int last = Geant4ActionProfile::NUM_BINS;
+    while( last > 0 && histogram[last-1] == 0 ) --last;
+    out << "[";
+    for( int k = 0; k < last; ++k )
+      out << (k ? ", " : "") << histogram[k];
+    out << "]";
+  }
+
+  /// Escape a string for JSON output
+  std::string json_escape(const std::string& str)  {
+    std::string res;
+    res.reserve(str.length());
+    for( char c : str )   {
+      if ( c == '"' || c == '\\' ) res += '\\';
+      res += c;
+    }
+    return res;
+  }
+}
+
+/// Set the profiling level. 0 disables profiling
+void Geant4ActionProfiler::enable(int level)   {
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.lock);
+  if ( level > 0 && s_level == 0 )   {
+    r.start_time  = std::chrono::steady_clock::now();
+    r.start_ticks = ticks();
+  }
+  s_level = level;
+}
+
+/// Timer ticks per second (calibrated against the steady clock)
+double Geant4ActionProfiler::ticksPerSecond()   {
+  const Registry& r = registry();
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - r.start_time).count();
+  uint64_t dt = ticks() - r.start_ticks;
+  if ( r.start_ticks == 0 || seconds < 1e-3 )
+    return 1e9;
+  return double(dt) / seconds;
+}
+
+/// Access the statistics record of an action for the calling thread. Created on first access
+Geant4ActionProfile* Geant4ActionProfiler::profile(const Geant4Action* action)   {
+  Geant4ActionProfile*& rec = s_threadRecords[action];
+  // A record of a deleted action at the same address was detached
+  if ( rec && rec->action == action ) return rec;
+  Registry& r = registry();
+  auto profile = std::make_unique<Geant4ActionProfile>();
+  profile->action = action;
+  profile->name   = action->name();
+  profile->type   = typeName(typeid(*action));
+  profile->thread = (unsigned long)::pthread_self();
+  std::lock_guard<std::mutex> lock(r.lock);
+  r.records.emplace_back(std::move(profile));
+  return rec = r.records.back().get();
+}
+
+/// Detach the records of an action, which is about to be deleted
+void Geant4ActionProfiler::detach(const Geant4Action* action)   {
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.lock);
+  for( auto& p : r.records )   {
+    if ( p->action == action ) p->action = nullptr;
+  }
+}
+
+/// Reset all records
+void Geant4ActionProfiler::reset()   {
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.lock);
+  for( auto& p : r.records )   {
+    Geant4ActionProfile& rec = *p;
+    rec.calls = rec.ticks = rec.cpu = rec.maxTicks = rec.maxCpu = 0;
+    std::fill(rec.histogram, rec.histogram + Geant4ActionProfile::NUM_BINS, 0);
+    std::fill(rec.cpuHistogram, rec.cpuHistogram + Geant4ActionProfile::NUM_BINS, 0);
+  }
+  r.start_time  = std::chrono::steady_clock::now();
+  r.start_ticks = ticks();
+}
+
+/// Print the summary of all records
+void Geant4ActionProfiler::print()   {
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.lock);
+  std::vector<Summary> summary = summarize(r.records);
+  std::map<unsigned long, int> thread_index;
+  const double us = 1e6 / ticksPerSecond();
+
+  for( const auto& p : r.records )
+    thread_index.emplace(p->thread, int(thread_index.size()));
+  printout(ALWAYS, "Geant4ActionProfiler",
+           "+++ Action profile: %ld actions in %ld threads. Times in micro seconds.",
+           long(summary.size()), long(thread_index.size()));
+  printout(ALWAYS, "Geant4ActionProfiler", "+++ %-32s %-36s %12s %14s %10s %12s %14s %12s",
+           "Name", "Type", "Calls", "Total", "Mean", "Max", "CPU", "Max CPU");
+  for( const Summary& s : summary )   {
+    printout(ALWAYS, "Geant4ActionProfiler", "+++ %-32s %-36s %12lu %14.0f %10.3f %12.1f %14.0f %12.1f",
+             s.first->name.c_str(), s.first->type.c_str(), (unsigned long)s.calls,
+             double(s.ticks)*us, double(s.ticks)*us/double(s.calls), double(s.maxTicks)*us,
+             double(s.cpu)*1e-3, double(s.maxCpu)*1e-3);
+    if ( s.threads.size() > 1 )   {
+      for( const Geant4ActionProfile* t : s.threads )   {
+        printout(ALWAYS, "Geant4ActionProfiler", "+++    Thread %-24d %-36s %12lu %14.0f %10.3f %12.1f %14.0f %12.1f",
+                 thread_index[t->thread], "", (unsigned long)t->calls,
+                 double(t->ticks)*us, double(t->ticks)*us/double(t->calls), double(t->maxTicks)*us,
+                 double(t->cpu)*1e-3, double(t->maxCpu)*1e-3);
+      }
+    }
+  }
+}
+
+/// Write the summary of all records as JSON file
+bool Geant4ActionProfiler::writeJSON(const std::string& file_name)   {
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.lock);
+  std::vector<Summary> summary = summarize(r.records);
+  std::map<unsigned long, int> thread_index;
+  const double ns = 1e9 / ticksPerSecond();
+  std::ofstream out(file_name);
+
+  for( const auto& p : r.records )
+    thread_index.emplace(p->thread, int(thread_index.size()));
+  out << "{\n  \"level\": " << s_level
+      << ",\n  \"threads\": " << thread_index.size()
+      << ",\n  \"histogram_edges_ns\": [";
+  for( int i = 0; i < Geant4ActionProfile::NUM_BINS; ++i )
+    out << (i ? ", " : "") << (i ? double(1ULL << (i-1))*ns : 0e0);
+  out << "],\n  \"cpu_histogram_edges_ns\": [";
+  for( int i = 0; i < Geant4ActionProfile::NUM_BINS; ++i )
+    out << (i ? ", " : "") << (i ? double(1ULL << (i-1)) : 0e0);
+  out << "],\n  \"actions\": [";
+  for( std::size_t i = 0; i < summary.size(); ++i )   {
+    const Summary& s = summary[i];
+    out << (i ? "," : "") << "\n    {\"name\": \"" << json_escape(s.first->name)
+        << "\", \"type\": \"" << json_escape(s.first->type)
+        << "\", \"calls\": " << s.calls
+        << ", \"wall_ns\": " << double(s.ticks)*ns
+        << ", \"max_ns\": "  << double(s.maxTicks)*ns
+        << ", \"cpu_ns\": "  << s.cpu
+        << ", \"max_cpu_ns\": " << s.maxCpu
+        << ", \"threads\": [";
+    for( std::size_t j = 0; j < s.threads.size(); ++j )   {
+      const Geant4ActionProfile* t = s.threads[j];
+      out << (j ? "," : "") << "\n      {\"thread\": " << thread_index[t->thread]
+          << ", \"calls\": " << t->calls
+          << ", \"wall_ns\": " << double(t->ticks)*ns
+          << ", \"max_ns\": "  << double(t->maxTicks)*ns
+          << ", \"cpu_ns\": "  << t->cpu
+          << ", \"max_cpu_ns\": " << t->maxCpu
+          << ", \"histogram\": ";
+      json_histogram(out, t->histogram);
+      if ( s_level > 1 )   {
+        out << ", \"cpu_histogram\": ";
+        json_histogram(out, t->cpuHistogram);
+      }
+      out << "}";
+    }
+    out << "]}";
+  }
+  out << "\n  ]\n}\n";
+  out.flush();
+  if ( !out.good() )   {
+    printout(ERROR, "Geant4ActionProfiler", "+++ Failed to write action profile to %s", file_name.c_str());
+    return false;
+  }
+  printout(INFO, "Geant4ActionProfiler", "+++ Action profile written to %s", file_name.c_str());
+  return true;
+}
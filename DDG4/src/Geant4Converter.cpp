@@ -71,6 +71,7 @@
 #include <G4MaterialPropertiesIndex.hh>
 #endif
 #include <G4ScaledSolid.hh>
+#include <G4TessellatedSolid.hh>
 #include <CLHEP/Units/SystemOfUnits.h>
 
 // C/C++ include files
@@ -78,6 +79,12 @@
 #include <iomanip>
 #include <sstream>
 #include <limits>
+#include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <exception>
 
 namespace units = dd4hep;
 using namespace dd4hep::sim;
@@ -151,6 +158,73 @@ namespace {
     return false;
   }
 
+  /// Check if a volume or any of its descendants is sensitive
+  bool has_sensitive_volume(const Geant4GeometryInfo& info, const TGeoVolume* vol)   {
+    for( const auto& sd : info.sensitives )  {
+      if ( sd.second.find(vol) != sd.second.end() )
+        return true;
+    }
+    for( Int_t i = 0, n = vol->GetNdaughters(); i < n; ++i )  {
+      if ( has_sensitive_volume(info, vol->GetNode(i)->GetVolume()) )
+        return true;
+    }
+    return false;
+  }
+
+  /// Execute func(i) for all i in [0,n) using up to num_threads threads
+  /** The calling thread participates. The first exception is re-thrown. */
+  template <typename F> void parallel_for(std::size_t n, int num_threads, F func)  {
+    std::size_t num = std::min(std::size_t(std::max(num_threads, 1)), n);
+    if ( num <= 1 )  {
+      for( std::size_t i = 0; i < n; ++i ) func(i);
+      return;
+    }
+    std::atomic<std::size_t> next { 0 };
+    std::exception_ptr error;
+    std::mutex error_lock;
+    auto work = [&]()  {
+      for( std::size_t i = next++; i < n; i = next++ )  {
+        try  {
+          func(i);
+        }
+        catch(...)  {
+          std::lock_guard<std::mutex> lock(error_lock);
+          if ( !error ) error = std::current_exception();
+        }
+      }
+    };
+    std::vector<std::thread> threads;
+    for( std::size_t i = 1; i < num; ++i ) threads.emplace_back(work);
+    work();
+    for( auto& t : threads ) t.join();
+    if ( error ) std::rethrow_exception(error);
+  }
+
+  /// Wall time accounting of the conversion phases
+  class ConversionTimer  {
+    struct Phase  {
+      std::string name;
+      double      seconds;
+      std::size_t count;
+    };
+    std::vector<Phase> m_phases;
+    TTimeStamp         m_start;
+  public:
+    /// Close the current phase
+    void next(const char* name, std::size_t count)  {
+      TTimeStamp now;
+      m_phases.emplace_back(Phase{ name, now.AsDouble()-m_start.AsDouble(), count });
+      m_start = now;
+    }
+    /// Print the phase summary
+    void print(PrintLevel level)  const  {
+      for( const Phase& p : m_phases )  {
+        printout(level, "Geant4Converter", "+++  Conversion phase %-24s %8.3f seconds %8ld objects",
+                 (p.name+":").c_str(), p.seconds, long(p.count));
+      }
+    }
+  };
+
   class G4UserRegionInformation : public G4VUserRegionInformation {
   public:
     Region region;
@@ -1100,17 +1174,23 @@ void* Geant4Converter::handlePlacement(const std::string& name, const TGeoNode*
       }
       PlacedVolume pv(node);
       const auto*  pv_data = pv.data();
+      const auto*  params  = pv_data ? pv_data->params : nullptr;
       G4LogicalVolume* g4vol = info.g4Volumes[vol];
       //G4LogicalVolume* g4mot = info.g4Volumes[mot_vol];
       G4PhysicalVolumesPair pvPlaced  { nullptr, nullptr };
 
-      if ( pv_data && pv_data->params && (pv_data->params->flags&Volume::REPLICATED) )   {
+      if ( !params )  {
+        /// Parameterisations of detected regular placements are owned by the geometry info
+        auto ipar = info.g4Parameterisations.find(pv);
+        if ( ipar != info.g4Parameterisations.end() ) params = ipar->second;
+      }
+      if ( params && (params->flags&Volume::REPLICATED) )   {
         EAxis  axis = kUndefined;
         double width = 0e0, offset = 0e0;
-        auto flags = pv_data->params->flags;
-        auto count = pv_data->params->trafo1D.second;
-        auto start = pv_data->params->start.Translation().Vect();
-        auto delta = pv_data->params->trafo1D.first.Translation().Vect();
+        auto flags = params->flags;
+        auto count = params->trafo1D.second;
+        auto start = params->start.Translation().Vect();
+        auto delta = params->trafo1D.first.Translation().Vect();
 
         if ( flags&Volume::X_axis )
         { axis = kXAxis; width = delta.X(); offset = start.X(); }
@@ -1143,11 +1223,11 @@ void* Geant4Converter::handlePlacement(const std::string& name, const TGeoNode*
         /// Update replica list to avoid additional conversions...
         auto* g4pv = pvPlaced.second ? pvPlaced.second : pvPlaced.first;
 #endif
-        for( auto& handle : pv_data->params->placements )
+        for( auto& handle : params->placements )
           info.g4Placements[handle.ptr()] = g4pv;
       }
-      else if ( pv_data && pv_data->params )   {
-        auto*  g4par = new Geant4PlacementParameterisation(pv);
+      else if ( params )   {
+        auto*  g4par = new Geant4PlacementParameterisation(pv, *params);
         auto*  g4pv  = new G4PVParameterised(name,              // its name
                                              g4vol,             // its logical volume
                                              g4mot,             // its mother (logical) volume
@@ -1156,7 +1236,7 @@ void* Geant4Converter::handlePlacement(const std::string& name, const TGeoNode*
                                              g4par);            // G4 parametrization
         pvPlaced = { g4pv, nullptr };
         /// Update replica list to avoid additional conversions...
-        for( auto& handle : pv_data->params->placements )
+        for( auto& handle : params->placements )
           info.g4Placements[handle.ptr()] = g4pv;
       }
       else    {
@@ -1751,10 +1831,125 @@ void* Geant4Converter::printPlacement(const std::string& name, const TGeoNode* n
   return g4;
 }
 
+/// Parameterise regularly placed identical daughters
+/**
+ *  Detects the pattern of daughters which could also have been created with
+ *  Volume::paramVolume1D/paramVolume2D: all daughters of the mother place the
+ *  same volume without rotation at positions forming a 1D or 2D arithmetic
+ *  sequence. Geant4 requires a parameterised volume to be the only daughter
+ *  of its mother. Only leaf volumes and volumes without sensitive descendants
+ *  are parameterised.
+ *  Volume IDs are only supported if every daughter has the single volume ID
+ *  with its index in the sequence as value, which is then replaced by the
+ *  Geant4 copy number like for explicit parameterisations.
+ */
+std::size_t Geant4Converter::handleReplicaPattern(const TGeoVolume* mother) const {
+  static constexpr double tolerance = 1e-9;
+  const std::size_t num_dau = mother->GetNdaughters();
+  if ( detectReplicas <= 0 || num_dau < std::max(std::size_t(detectReplicas), std::size_t(2)) )
+    return 0;
+  else if ( mother->IsAssembly() )
+    return 0;
+
+  Geant4GeometryInfo& info = data();
+  const TGeoVolume*   vol  = mother->GetNode(0)->GetVolume();
+  if ( vol->IsAssembly() || Volume(vol).testFlagBit(Volume::VETO_SIMU) )
+    return 0;
+  else if ( vol->GetNdaughters() > 0 && has_sensitive_volume(info, vol) )
+    return 0;
+
+  const PlacedVolume::VolIDs& first_ids = PlacedVolume(mother->GetNode(0)).volIDs();
+  std::vector<Position> pos;
+  pos.reserve(num_dau);
+  for( std::size_t i = 0; i < num_dau; ++i )  {
+    PlacedVolume pv(mother->GetNode(i));
+    const auto*  ext = pv.data();
+    if ( pv->GetVolume() != vol || !ext || ext->params || info.g4Parameterisations.count(pv) )
+      return 0;
+    const auto& ids = ext->volIDs;
+    if ( ids.size() != first_ids.size() || ids.size() > 1 )
+      return 0;
+    else if ( !ids.empty() && (ids[0].first != first_ids[0].first || ids[0].second != int(i)) )
+      return 0;
+    const TGeoMatrix* m = pv->GetMatrix();
+    const Double_t*   r = m->GetRotationMatrix();
+    for( int k = 0; k < 9; ++k )  {
+      if ( std::abs(r[k] - ((k%4) == 0 ? 1e0 : 0e0)) > tolerance )
+        return 0;
+    }
+    const Double_t* t = m->GetTranslation();
+    pos.emplace_back(t[0], t[1], t[2]);
+  }
+  auto same = [](const Position& a, const Position& b)  {
+    return (a-b).R() <= tolerance * (1e0 + a.R());
+  };
+  // First dimension: longest arithmetic sequence from the start
+  const Position delta1 = pos[1] - pos[0];
+  if ( delta1.R() <= tolerance )
+    return 0;
+  std::size_t n1 = 2;
+  while( n1 < num_dau && same(pos[n1], pos[0] + double(n1)*delta1) ) ++n1;
+  std::size_t n2 = num_dau / n1;
+  if ( n1*n2 != num_dau )
+    return 0;
+  // Second dimension: the rows must repeat with a constant offset
+  const Position delta2 = n2 > 1 ? pos[n1] - pos[0] : Position();
+  for( std::size_t j = 0; j < n2; ++j )  {
+    for( std::size_t i = 0; i < n1; ++i )  {
+      if ( !same(pos[j*n1+i], pos[0] + double(i)*delta1 + double(j)*delta2) )
+        return 0;
+    }
+  }
+  // Same parameterisation as Volume::paramVolume1D/2D, but kept by the geometry info
+  auto* params = new PlacedVolumeExtension::Parameterisation();
+  params->flags = Volume::PARAMETERIZED;
+  params->start = Transform3D(pos[0]);
+  params->trafo1D.first  = Transform3D(delta1);
+  params->trafo1D.second = n1;
+  if ( n2 > 1 )  {
+    params->trafo2D.first  = Transform3D(delta2);
+    params->trafo2D.second = n2;
+  }
+  for( std::size_t i = 0; i < num_dau; ++i )  {
+    PlacedVolume pv(mother->GetNode(i));
+    params->placements.emplace_back(pv);
+    info.g4Parameterisations[pv] = params->addref();
+  }
+  printout(debugPlacements ? ALWAYS : outputLevel, "Geant4Converter",
+           "++ Parameterise %ld x %ld placements of %s in mother %s",
+           long(n1), long(n2), vol->GetName(), mother->GetName());
+  return num_dau;
+}
+
+/// Convert all tessellated solids in parallel
+std::size_t Geant4Converter::handleTessellatedSolids(const std::vector<TGeoShape*>& solids) const {
+  Geant4GeometryInfo& info = data();
+  std::vector<std::pair<const TGeoTessellated*, G4TessellatedSolid*> > work;
+  for( TGeoShape* shape : solids )  {
+    if ( shape->IsA() == TGeoTessellated::Class() && !info.g4Solids[shape] )  {
+      work.emplace_back((const TGeoTessellated*)shape, nullptr);
+    }
+  }
+  // Largest solids first for a better balance between the threads
+  std::sort(work.begin(), work.end(), [](const auto& a, const auto& b)  {
+      return a.first->GetNfacets() > b.first->GetNfacets();
+    });
+  // The Geant4 solid store is not thread safe: create the solids sequentially
+  for( auto& w : work )  {
+    w.second = new G4TessellatedSolid(w.first->GetName());
+    info.g4Solids[w.first] = w.second;
+  }
+  parallel_for(work.size(), numThreads, [&work](std::size_t i)  {
+      fillTessellatedSolid(work[i].first, work[i].second);
+    });
+  return work.size();
+}
+
 /// Create geometry conversion
 Geant4Converter& Geant4Converter::create(DetElement top) {
   typedef std::map<const TGeoNode*, std::vector<TGeoNode*> > _DAU;
   TTimeStamp start;
+  ConversionTimer timer;
   _DAU daughters;
   Geant4GeometryInfo& geo = this->init();
   World wrld = top.world();
@@ -1765,37 +1960,67 @@ Geant4Converter& Geant4Converter::create(DetElement top) {
   geo.manager = &wrld.detectorDescription().manager();
   this->collect(top, geo);
   this->checkOverlaps = false;
+  timer.next("collect", geo.volumes.size());
   // We do not have to handle defines etc.
   // All positions and the like are not really named.
   // Hence, start creating the G4 objects for materials, solids and log volumes.
   handleArray(this, geo.manager->GetListOfGDMLMatrices(), &Geant4Converter::handleMaterialProperties);
   handleArray(this, geo.manager->GetListOfOpticalSurfaces(), &Geant4Converter::handleOpticalSurface);
+  timer.next("optical properties", geo.manager->GetListOfGDMLMatrices()->GetEntries()+
+             geo.manager->GetListOfOpticalSurfaces()->GetEntries());
   
   handle(this,     geo.volumes, &Geant4Converter::collectVolume);
+  if ( detectReplicas > 0 )  {
+    std::size_t num_replicas = 0;
+    for( const auto& v : geo.volumes )
+      num_replicas += handleReplicaPattern(v.ptr());
+    timer.next("replica detection", num_replicas);
+  }
+  if ( numThreads > 1 )  {
+    std::size_t num_tessellated = handleTessellatedSolids(geo.solids);
+    timer.next("tessellated solids", num_tessellated);
+  }
   handle(this,     geo.solids,  &Geant4Converter::handleSolid);
   printout(outputLevel, "Geant4Converter", "++ Handled %ld solids.", geo.solids.size());
+  timer.next("solids", geo.solids.size());
   handleRefs(this, geo.vis,     &Geant4Converter::handleVis);
   printout(outputLevel, "Geant4Converter", "++ Handled %ld visualization attributes.", geo.vis.size());
   handleMap(this,  geo.limits,  &Geant4Converter::handleLimitSet);
   printout(outputLevel, "Geant4Converter", "++ Handled %ld limit sets.", geo.limits.size());
   handleMap(this,  geo.regions, &Geant4Converter::handleRegion);
   printout(outputLevel, "Geant4Converter", "++ Handled %ld regions.", geo.regions.size());
+  timer.next("vis, limits, regions", geo.vis.size()+geo.limits.size()+geo.regions.size());
   handle(this,     geo.volumes, &Geant4Converter::handleVolume);
   printout(outputLevel, "Geant4Converter", "++ Handled %ld volumes.", geo.volumes.size());
+  timer.next("materials and volumes", geo.volumes.size());
+  auto num_assemblies = [&geo]()  {
+    return std::count_if(geo.g4AssemblyVolumes.begin(), geo.g4AssemblyVolumes.end(),
+                         [](const auto& a)  { return a.second != nullptr; });
+  };
+  std::size_t num_converted = num_assemblies();
   handleRMap(this, *m_data,     &Geant4Converter::handleAssembly);
+  num_converted = num_assemblies() - num_converted;
+  printout(outputLevel, "Geant4Converter", "++ Handled %ld assemblies.", num_converted);
+  timer.next("assemblies", num_converted);
   // Now place all this stuff appropriately
   //handleRMap(this, *m_data,     &Geant4Converter::handlePlacement);
+  std::size_t num_nodes = 0;
   std::map<int, std::vector<const TGeoNode*> >::const_reverse_iterator i = m_data->rbegin();
   for ( ; i != m_data->rend(); ++i )  {
     for ( const TGeoNode* node : i->second )  {
       this->handlePlacement(node->GetName(), node);
     }
+    num_nodes += i->second.size();
   }
+  timer.next("placements", num_nodes);
   /// Handle concrete surfaces
   handleArray(this, geo.manager->GetListOfSkinSurfaces(),   &Geant4Converter::handleSkinSurface);
   handleArray(this, geo.manager->GetListOfBorderSurfaces(), &Geant4Converter::handleBorderSurface);
+  timer.next("surfaces", geo.manager->GetListOfSkinSurfaces()->GetEntries()+
+             geo.manager->GetListOfBorderSurfaces()->GetEntries());
   //==================== Fields
   handleProperties(m_detDesc.properties());
+  timer.next("properties", m_detDesc.properties().size());
   if ( printSensitives )  {
     handleMap(this, geo.sensitives, &Geant4Converter::printSensitive);
   }
@@ -1807,6 +2032,7 @@ Geant4Converter& Geant4Converter::create(DetElement top) {
   geo.setWorld(top.placement().ptr());
   geo.valid = true;
   TTimeStamp stop;
+  timer.print(INFO);
   printout(INFO, "Geant4Converter",
            "+++  Successfully converted geometry to Geant4. [%7.3f seconds]",
            stop.AsDouble()-start.AsDouble() );
@@ -17,6 +17,7 @@
 
 #include <DDG4/Geant4Data.h>
 #include <DDG4/Geant4StepHandler.h>
+#include <DDG4/Geant4StepContext.h>
 #include <DDG4/Geant4FastSimHandler.h>
 
 // Geant4 include files
@@ -24,8 +25,173 @@
 #include <G4Allocator.hh>
 #include <G4OpticalPhoton.hh>
 
+// C/C++ include files
+#include <atomic>
+#include <new>
+
 using namespace dd4hep::sim;
 
+namespace  {
+
+  /// Memory block of the hit arena
+  /*
+   *  The reference count is the number of live chunks plus one reference held by
+   *  the owning thread. Whoever drops the last reference deletes the block.
+   *  Hence a long-lived hit keeps only its own block allocated.
+   */
+  struct alignas(std::max_align_t) HitBlock  {
+    static constexpr std::size_t BLOCK_SIZE = 64*1024;
+    std::atomic<long>   refs   { 1 };
+
+    /// Allocate a new block
+    static HitBlock* create()   {
+      return new(::operator new(BLOCK_SIZE)) HitBlock();
+    }
+    /// Check if all chunks allocated from the block are deleted
+    bool empty()  const   {  return refs.load(std::memory_order_acquire) == 1; }
+    /// Drop one reference. Deletes the block with the last reference
+    void release()   {
+      if ( refs.fetch_sub(1, std::memory_order_acq_rel) == 1 )  {
+        this->~HitBlock();
+        ::operator delete(this);
+      }
+    }
+  };
+
+  /// Chunk header: records the block a hit was allocated from. Null for heap chunks
+  struct alignas(std::max_align_t) HitChunk  {
+    HitBlock* block;
+  };
+
+  /// Hit arena of one thread
+  /*
+   *  The blocks used during an event are released in bulk at the end of the event:
+   *  blocks without live hits are kept for reuse, blocks with live hits are
+   *  recycled as soon as their last hit is deleted. The memory retained by a
+   *  thread is bounded: at most MAX_SPARE free blocks are kept, and at most
+   *  MAX_PENDING blocks with live hits are watched for recycling. Beyond that
+   *  the thread drops its reference and the block is freed by its last hit.
+   */
+  class HitArena  {
+  public:
+    static constexpr std::size_t MAX_SPARE   = 64;
+    static constexpr std::size_t MAX_PENDING = 256;
+    static constexpr std::size_t CAPACITY    = HitBlock::BLOCK_SIZE - sizeof(HitBlock);
+    /// Block used for the next allocations
+    HitBlock*              current { nullptr };
+    /// Next free byte in the current block
+    std::size_t            offset  { 0 };
+    /// Blocks used during the current event
+    std::vector<HitBlock*> used;
+    /// Blocks of previous events with live hits
+    std::vector<HitBlock*> pending;
+    /// Free blocks. The next block to be used is the last one
+    std::vector<HitBlock*> spare;
+
+    /// Default constructor
+    HitArena() = default;
+    /// Default destructor. Blocks with live hits are deleted by the last hit
+    ~HitArena()   {
+      for( HitBlock* b : used )    b->release();
+      for( HitBlock* b : pending ) b->release();
+      for( HitBlock* b : spare )   b->release();
+    }
+    /// Move the free blocks of the list to the spare blocks. Keeps the order of reuse
+    void recycle(std::vector<HitBlock*>& blocks)   {
+      std::vector<HitBlock*> free_blocks;
+      std::size_t num = 0;
+      for( HitBlock* b : blocks )  {
+        if ( b->empty() )
+          free_blocks.emplace_back(b);
+        else
+          blocks[num++] = b;
+      }
+      blocks.resize(num);
+      for( auto i = free_blocks.rbegin(); i != free_blocks.rend(); ++i )  {
+        if ( spare.size() < MAX_SPARE )
+          spare.emplace_back(*i);
+        else
+          (*i)->release();
+      }
+    }
+    /// Access a free block
+    HitBlock* block()   {
+      if ( spare.empty() ) recycle(pending);
+      if ( spare.empty() ) return HitBlock::create();
+      HitBlock* b = spare.back();
+      spare.pop_back();
+      return b;
+    }
+    /// Allocate a chunk of the given (aligned) size
+    char* allocate(std::size_t size)  {
+      if ( !current || offset + size > CAPACITY )  {
+        if ( current && current->empty() )  {
+          offset = 0;
+        }
+        else  {
+          current = block();
+          used.emplace_back(current);
+          offset = 0;
+        }
+      }
+      char* chunk = (char*)(current + 1) + offset;
+      offset += size;
+      current->refs.fetch_add(1, std::memory_order_relaxed);
+      return chunk;
+    }
+    /// Release the blocks of the current event
+    void close()   {
+      if ( !used.empty() )  {
+        recycle(used);
+        pending.insert(pending.end(), used.begin(), used.end());
+        used.clear();
+        current = nullptr;
+        offset  = 0;
+        if ( pending.size() > MAX_PENDING )  {
+          recycle(pending);
+          if ( pending.size() > MAX_PENDING )  {
+            std::size_t num = pending.size() - MAX_PENDING;
+            for( std::size_t i = 0; i < num; ++i ) pending[i]->release();
+            pending.erase(pending.begin(), pending.begin() + num);
+          }
+        }
+      }
+    }
+  };
+  thread_local HitArena s_hitArena;
+}
+
+/// Allocate hit memory from the arena of the current thread
+void* Geant4HitArena::allocate(std::size_t size)  {
+  constexpr std::size_t align = alignof(HitChunk);
+  std::size_t len = sizeof(HitChunk) + (size + align - 1) / align * align;
+  HitChunk* chunk = nullptr;
+  if ( len > HitArena::CAPACITY )  {
+    chunk = new(::operator new(len)) HitChunk { nullptr };
+  }
+  else  {
+    char* mem = s_hitArena.allocate(len);
+    chunk = new(mem) HitChunk { s_hitArena.current };
+  }
+  return chunk + 1;
+}
+
+/// Return hit memory to the block it was allocated from. May be called by any thread
+void Geant4HitArena::release(void* ptr)  {
+  if ( ptr )  {
+    HitChunk* chunk = static_cast<HitChunk*>(ptr) - 1;
+    if ( chunk->block )
+      chunk->block->release();
+    else
+      ::operator delete(chunk);
+  }
+}
+
+/// Release the blocks of the current event of the current thread
+void Geant4HitArena::endEvent()  {
+  s_hitArena.close();
+}
+
 /// Default constructor
 SimpleRun::SimpleRun()  {
   InstanceCount::increment(this);
@@ -63,13 +229,13 @@ Geant4HitData::~Geant4HitData() {
 /// Extract the MC contribution for a given hit from the step information
 Geant4HitData::Contribution Geant4HitData::extractContribution(const G4Step* step) {
   Geant4StepHandler h(step);
+  Geant4StepContext& ctxt = Geant4StepContext::get(step);
   double deposit =
     (h.trackDef() == G4OpticalPhoton::OpticalPhotonDefinition()) ? h.trkEnergy() : h.totalEnergy();
-  const G4ThreeVector& pre   = h.prePosG4();
-  const G4ThreeVector& post  = h.postPosG4();
+  const G4ThreeVector& mid   = ctxt.midpointG4();
   G4ThreeVector        mom   = h.track->GetMomentum();
-  double               len   = (post-pre).mag() ;
-  double               position[] = { (pre.x()+post.x())/2.0,(pre.y()+post.y())/2.0,(pre.z()+post.z())/2.0 };
+  double               len   = ctxt.chordLength();
+  double               position[] = { mid.x(), mid.y(), mid.z() };
   double               momentum[] = { mom.x(), mom.y(), mom.z() };
   return Contribution(h.trkID(), h.trkPdgID(), deposit, h.trkTime(), len, position, momentum);
 }
@@ -80,12 +246,12 @@ Geant4HitData::Contribution Geant4HitData::extractContribution(const G4Step* ste
   if ( ApplyBirksLaw == true ) h.doApplyBirksLaw();
   double deposit =
     (h.trackDef() == G4OpticalPhoton::OpticalPhotonDefinition()) ? h.trkEnergy() : h.totalEnergy();
-  const G4ThreeVector& pre  = h.prePosG4();
-  const G4ThreeVector& post = h.postPosG4();
+  Geant4StepContext&   ctxt = Geant4StepContext::get(step);
+  const G4ThreeVector& mid  = ctxt.midpointG4();
   G4ThreeVector        mom  = h.track->GetMomentum();
-  double length = (post-pre).mag() ;
+  double length = ctxt.chordLength();
   double momentum[] = { mom.x(), mom.y(), mom.z() };
-  double position[] = { (pre.x()+post.x())/2.0,(pre.y()+post.y())/2.0,(pre.z()+post.z())/2.0 };
+  double position[] = { mid.x(), mid.y(), mid.z() };
   return Contribution(h.trkID(), h.trkPdgID(), deposit, h.trkTime(), length, position, momentum);
 }
 
@@ -129,6 +295,16 @@ Geant4Tracker::Hit::~Hit() {
   InstanceCount::decrement(this);
 }
 
+/// Object allocator from the thread local hit arena
+void* Geant4Tracker::Hit::operator new(std::size_t size)  {
+  return Geant4HitArena::allocate(size);
+}
+
+/// Object destroyer: return the memory to the hit arena
+void Geant4Tracker::Hit::operator delete(void* ptr, std::size_t /* size */)  {
+  Geant4HitArena::release(ptr);
+}
+
 /// Explicit assignment operation
 void Geant4Tracker::Hit::copyFrom(const Hit& c) {
   if ( &c != this )  {
@@ -208,3 +384,13 @@ Geant4Calorimeter::Hit::Hit(const Position& pos) : position(pos)  {
 Geant4Calorimeter::Hit::~Hit() {
   InstanceCount::decrement(this);
 }
+
+/// Object allocator from the thread local hit arena
+void* Geant4Calorimeter::Hit::operator new(std::size_t size)  {
+  return Geant4HitArena::allocate(size);
+}
+
+/// Object destroyer: return the memory to the hit arena
+void Geant4Calorimeter::Hit::operator delete(void* ptr, std::size_t /* size */)  {
+  Geant4HitArena::release(ptr);
+}
@@ -122,6 +122,13 @@ Geant4DetectorConstruction* Geant4DetectorConstructionSequence::get(const std::s
 /// Geometry construction callback. Called at "Construct()"
 void Geant4DetectorConstructionSequence::constructGeo(Geant4DetectorConstructionContext* ctxt)  {
   m_actors(&Geant4DetectorConstruction::constructGeo, ctxt);  
+  Geant4Mapping& mapping = Geant4Mapping::instance();
+  Geant4GeometryInfo* p = mapping.ptr();
+  if ( p && mapping.freezeGeometry && !p->frozen )  {
+    // The volume manager needs the placement maps: populate it first
+    if ( mapping.haveVolManager ) mapping.volumeManager();
+    p->freeze();
+  }
 }
 
 /// Electromagnetic field construction callback. Called at "ConstructSDandField()"
@@ -153,7 +160,9 @@ Geant4DetectorConstructionSequence::volumes() const  {
 /// Access to the converted shapes
 const std::map<const TGeoShape*, G4VSolid*>& Geant4DetectorConstructionSequence::shapes() const  {
   Geant4GeometryInfo* p = Geant4Mapping::instance().ptr();
-  if ( p ) return p->g4Solids;
+  if ( p && p->frozen )
+    except("+++ Geant4DetectorConstructionSequence::shapes: Access not possible. The geometry info is frozen!");
+  else if ( p ) return p->g4Solids;
   throw std::runtime_error("+++ Geant4DetectorConstructionSequence::shapes: Access not possible. Geometry is not yet converted!");
 }
 
@@ -177,7 +186,9 @@ Geant4DetectorConstructionSequence::assemblies() const  {
 const std::map<dd4hep::PlacedVolume, G4VPhysicalVolume*>&
 Geant4DetectorConstructionSequence::placements() const  {
   Geant4GeometryInfo* p = Geant4Mapping::instance().ptr();
-  if ( p ) return p->g4Placements;
+  if ( p && p->frozen )
+    except("+++ Geant4DetectorConstructionSequence::placements: Access not possible. The geometry info is frozen!");
+  else if ( p ) return p->g4Placements;
   throw std::runtime_error("+++ Geant4DetectorConstructionSequence::placements: Access not possible. Geometry is not yet converted!");
 }
 
@@ -191,6 +202,8 @@ const Geant4GeometryMaps::MaterialMap& Geant4DetectorConstructionSequence::mater
 /// Access to the converted elements
 const Geant4GeometryMaps::ElementMap& Geant4DetectorConstructionSequence::elements() const  {
   Geant4GeometryInfo* p = Geant4Mapping::instance().ptr();
-  if ( p ) return p->g4Elements;
+  if ( p && p->frozen )
+    except("+++ Geant4DetectorConstructionSequence::elements: Access not possible. The geometry info is frozen!");
+  else if ( p ) return p->g4Elements;
   throw std::runtime_error("+++ Geant4DetectorConstructionSequence::elements: Access not possible. Geometry is not yet converted!");
 }
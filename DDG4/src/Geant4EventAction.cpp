@@ -14,6 +14,7 @@
 // Framework include files
 #include <DD4hep/InstanceCount.h>
 #include <DDG4/Geant4EventAction.h>
+#include <DDG4/Geant4StepContext.h>
 
 // Geant4 headers
 #include <G4Threading.hh>
@@ -140,6 +141,8 @@ void Geant4EventActionSequence::adopt(Geant4EventAction* action) {
 
 /// Pre-track action callback
 void Geant4EventActionSequence::begin(const G4Event* event)   {
+  // Steps of the previous event must not match steps of this event
+  Geant4StepContext::instance().reset();
   m_actors(&Geant4EventAction::begin, event);
   m_begin(event);
 }
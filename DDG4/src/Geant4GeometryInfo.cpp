@@ -21,6 +21,27 @@
 
 using namespace dd4hep::sim;
 
+namespace  {
+  /// Approximate size of a red-black tree node without the payload
+  constexpr std::size_t TREE_NODE_SIZE = 4*sizeof(void*);
+
+  /// Approximate memory used by a std::map or std::set
+  template <typename T> std::size_t tree_memory(const T& container)  {
+    return container.size() * (TREE_NODE_SIZE + sizeof(typename T::value_type));
+  }
+  /// Approximate memory used by a std::map of std::sets
+  template <typename T> std::size_t tree_of_trees_memory(const T& container)  {
+    std::size_t mem = tree_memory(container);
+    for( const auto& entry : container )
+      mem += tree_memory(entry.second);
+    return mem;
+  }
+  /// Release the memory of a container
+  template <typename T> void release(T& container)  {
+    T().swap(container);
+  }
+}
+
 /// Default constructor
 Geant4GeometryInfo::Geant4GeometryInfo()
   : TNamed("Geant4GeometryInfo", "Geant4GeometryInfo"), m_world(0), printLevel(DEBUG), valid(false) {
@@ -31,6 +52,9 @@ Geant4GeometryInfo::~Geant4GeometryInfo() {
   for( auto& a : g4AssemblyVolumes )
     delete a.second;
   g4AssemblyVolumes.clear();
+  for( auto& p : g4Parameterisations )
+    p.second->release();
+  g4Parameterisations.clear();
 }
 
 /// The world placement
@@ -49,3 +73,79 @@ void Geant4GeometryInfo::setWorld(const TGeoNode* node)    {
   }
   m_world = g4;
 }
+
+/// Access the dd4hep placement of a Geant4 physical volume. Invalid handle if not found
+dd4hep::PlacedVolume Geant4GeometryInfo::placement(const G4VPhysicalVolume* pv)  const   {
+  if ( frozen )  {
+    const auto* node = g4PlacementIndex.find(uint64_t(pv));
+    return PlacedVolume(node ? *node : nullptr);
+  }
+  for( const auto& entry : g4Placements )  {
+    if ( entry.second == pv )
+      return PlacedVolume(entry.first);
+  }
+  return PlacedVolume(nullptr);
+}
+
+/// Release the maps only needed during the conversion. Returns the number of bytes released
+std::size_t Geant4GeometryInfo::freeze()   {
+  if ( frozen )  {
+    return 0;
+  }
+  std::size_t released = 0;
+  released += tree_memory(g4Isotopes);
+  released += tree_memory(g4Elements);
+  released += tree_memory(g4Solids);
+  released += tree_memory(g4Placements);
+  released += tree_memory(g4Parameterised);
+  released += tree_memory(g4Replicated);
+  released += tree_memory(g4OpticalProperties);
+  released += tree_memory(g4OpticalSurfaces);
+  released += tree_memory(g4SkinSurfaces);
+  released += tree_memory(g4BorderSurfaces);
+  released += tree_memory(g4Vis);
+  released += tree_of_trees_memory(regions);
+  released += tree_of_trees_memory(limits);
+  released += tree_memory(g4VolumeImprints);
+  for( const auto& imprints : g4VolumeImprints )  {
+    released += imprints.second.capacity() * sizeof(Geant4GeometryMaps::ImprintEntry);
+    for( const auto& entry : imprints.second )
+      released += entry.first.capacity() * sizeof(const TGeoNode*);
+  }
+  for( auto& p : g4OpticalProperties )  {
+    released += sizeof(PropertyVector) + (p.second->bins.capacity() + p.second->values.capacity())*sizeof(double);
+    delete p.second;
+  }
+
+  /// Reverse lookup of the placements used at run time
+  g4PlacementIndex.clear();
+  g4PlacementIndex.reserve(g4Placements.size());
+  for( const auto& entry : g4Placements )
+    g4PlacementIndex[uint64_t(entry.second)] = entry.first.ptr();
+  g4PlacementIndex.freeze();
+
+  release(g4Isotopes);
+  release(g4Elements);
+  release(g4Solids);
+  release(g4Placements);
+  release(g4Parameterised);
+  release(g4Replicated);
+  release(g4OpticalProperties);
+  release(g4OpticalSurfaces);
+  release(g4SkinSurfaces);
+  release(g4BorderSurfaces);
+  release(g4Vis);
+  release(regions);
+  release(limits);
+  release(g4VolumeImprints);
+  g4CopyFields.shrink_to_fit();
+  frozen = true;
+
+  std::size_t index = g4PlacementIndex.memoryUsage();
+  printout(INFO, "Geant4GeometryInfo",
+           "+++ Frozen geometry info: released ~%ld kB. Placement index: %ld entries [%ld kB]. "
+           "Kept %ld volumes, %ld materials, %ld sensitive detectors.",
+           long(released/1024), long(g4PlacementIndex.size()), long(index/1024),
+           long(g4Volumes.size()), long(g4Materials.size()), long(sensitives.size()));
+  return released > index ? released - index : 0;
+}
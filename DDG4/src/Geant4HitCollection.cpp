@@ -14,12 +14,17 @@
 // Framework include files
 #include <DD4hep/InstanceCount.h>
 #include <DDG4/Geant4HitCollection.h>
+#include <DDG4/Geant4SensDetAction.h>
 #include <DDG4/Geant4Data.h>
 #include <G4Allocator.hh>
 
 using namespace dd4hep::sim;
 
 G4ThreadLocal G4Allocator<Geant4HitWrapper>* HitWrapperAllocator = 0;
+/// Key maps of deleted collections: the memory is re-used by the next collections
+G4ThreadLocal std::vector<Geant4HitCollection::Keys>* SpareHitKeys = 0;
+/// Maximal number of spare key maps kept per thread. Further key maps are released
+static constexpr std::size_t MAX_SPARE_HIT_KEYS = 32;
 
 Geant4HitWrapper::InvalidHit::~InvalidHit() {
 }
@@ -79,7 +84,16 @@ Geant4HitCollection::Compare::~Compare()  {
 /// Default destructor
 Geant4HitCollection::~Geant4HitCollection() {
   m_hits.clear();
+  if ( m_keys.capacity() > 0 )  {
+    if ( !SpareHitKeys )
+      SpareHitKeys = new std::vector<Keys>();
+    if ( SpareHitKeys->size() < MAX_SPARE_HIT_KEYS )  {
+      m_keys.reset();
+      SpareHitKeys->emplace_back(std::move(m_keys));
+    }
+  }
   m_keys.clear();
+  Geant4HitArena::endEvent();
   InstanceCount::decrement(this);
 }
 
@@ -96,13 +110,28 @@ const dd4hep::ComponentCast& Geant4HitCollection::vector_type() const {
 /// Notification to increase the instance counter
 void Geant4HitCollection::newInstance() {
   InstanceCount::increment(this);
+  if ( m_detector )  {
+    m_keyReserve = m_detector->expectedHits();
+  }
+}
+
+/// Prepare the key map before the first keyed insertion
+void Geant4HitCollection::prepareKeys()  {
+  if ( SpareHitKeys && !SpareHitKeys->empty() )  {
+    m_keys = std::move(SpareHitKeys->back());
+    SpareHitKeys->pop_back();
+  }
+  if ( m_keyReserve > 0 )  {
+    m_keys.reserve(m_keyReserve);
+  }
 }
 
 /// Clear the collection (Deletes all valid references to real hits)
 void Geant4HitCollection::clear()   {
   m_lastHit = ULONG_MAX;
   m_hits.clear();
-  m_keys.clear();
+  m_keys.reset();
+  Geant4HitArena::endEvent();
 }
 
 /// Find hit in a collection by comparison of attributes
@@ -123,9 +152,9 @@ void* Geant4HitCollection::findHit(const Compare& cmp)  {
 
 /// Find hit in a collection by comparison of the key
 Geant4HitWrapper* Geant4HitCollection::findHitByKey(VolumeID key)   {
-  Keys::const_iterator i=m_keys.find(key);
-  if ( i == m_keys.end() ) return 0;
-  m_lastHit = (*i).second;
+  const size_t* i = m_keys.find(key);
+  if ( !i ) return 0;
+  m_lastHit = *i;
   return &m_hits.at(m_lastHit);
 }
 
@@ -141,7 +170,7 @@ void Geant4HitCollection::releaseData(const ComponentCast& cast, std::vector<voi
       result->emplace_back(m->cast.apply_downCast(cast, w.release()));
   }
   m_lastHit = ULONG_MAX;
-  m_keys.clear();
+  m_keys.reset();
 }
 
 /// Release all hits from the Geant4 container. Ownership stays with the container
@@ -165,7 +194,7 @@ void Geant4HitCollection::releaseHitsUnchecked(std::vector<void*>& result) {
     result.emplace_back(w.release());
   }
   m_lastHit = ULONG_MAX;
-  m_keys.clear();
+  m_keys.reset();
 }
 
 /// Release all hits from the Geant4 container. Ownership stays with the container
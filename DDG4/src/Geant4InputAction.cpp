@@ -23,10 +23,125 @@
 
 #include <G4Event.hh>
 
+// C/C++ include files
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 using namespace dd4hep::sim;
 using Vertices = Geant4InputAction::Vertices;
 using PropertyMask = dd4hep::detail::ReferenceBitMask<int>;
 
+namespace {
+  /// Private context of the read-ahead thread. Hosts the extensions of the event being decoded
+  class PrefetchContext : public Geant4Context  {
+  public:
+    PrefetchContext(Geant4Kernel* kernel) : Geant4Context(kernel) {}
+  };
+  /// Context seen by the event readers running in the read-ahead thread
+  thread_local Geant4Context* s_prefetchContext = nullptr;
+}
+
+/// Read-ahead stage decoding the next events in a background thread
+class Geant4InputAction::Prefetch  {
+public:
+  /// Decoded event ready to be consumed
+  struct Event  {
+    int                          number     { 0 };
+    int                          status     { Geant4EventReader::EVENT_READER_ERROR };
+    Vertices                     vertices   { };
+    Particles                    particles  { };
+    /// Event extensions created by the reader
+    std::unique_ptr<Geant4Event> extensions { };
+    /// Exception message if the reader failed
+    std::string                  error      { };
+  };
+
+private:
+  Geant4EventReader*      m_reader;
+  Geant4Kernel*           m_kernel;
+  std::size_t             m_depth;
+  std::thread             m_thread      { };
+  std::mutex              m_lock        { };
+  std::condition_variable m_haveEvents  { };
+  std::condition_variable m_haveSpace   { };
+  std::deque<Event>       m_queue       { };
+  bool                    m_stop        { false };
+  bool                    m_done        { false };
+
+  /// Read-ahead thread: decode events starting from first_event until stopped or the reader fails
+  void run(int first_event)   {
+    PrefetchContext ctxt(m_kernel);
+    s_prefetchContext = &ctxt;
+    for( int evid = first_event; ; ++evid )   {
+      {
+        std::unique_lock<std::mutex> guard(m_lock);
+        m_haveSpace.wait(guard, [this] { return m_stop || m_queue.size() < m_depth; });
+        if ( m_stop ) break;
+      }
+      Event evt;
+      evt.number     = evid;
+      evt.extensions = std::make_unique<Geant4Event>(nullptr, nullptr);
+      ctxt.setEvent(evt.extensions.get());
+      try  {
+        evt.status = m_reader->moveToEvent(evid);
+        if ( evt.status == Geant4EventReader::EVENT_READER_OK )
+          evt.status = m_reader->readParticles(evid, evt.vertices, evt.particles);
+      }
+      catch(const std::exception& e)  {
+        evt.status = Geant4EventReader::EVENT_READER_ERROR;
+        evt.error  = e.what();
+      }
+      ctxt.setEvent(nullptr);
+      bool last = evt.status != Geant4EventReader::EVENT_READER_OK;
+      {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_queue.emplace_back(std::move(evt));
+      }
+      m_haveEvents.notify_one();
+      if ( last ) break;
+    }
+    s_prefetchContext = nullptr;
+    {
+      std::lock_guard<std::mutex> guard(m_lock);
+      m_done = true;
+    }
+    m_haveEvents.notify_all();
+  }
+
+public:
+  /// Initializing constructor: start the read-ahead thread
+  Prefetch(Geant4EventReader* reader, Geant4Kernel* kernel, std::size_t depth, int first_event)
+    : m_reader(reader), m_kernel(kernel), m_depth(depth)
+  {
+    m_thread = std::thread([this, first_event] { this->run(first_event); });
+  }
+  /// Default destructor: stop the thread and release the events not consumed
+  ~Prefetch()   {
+    {
+      std::lock_guard<std::mutex> guard(m_lock);
+      m_stop = true;
+    }
+    m_haveSpace.notify_all();
+    if ( m_thread.joinable() ) m_thread.join();
+    for( auto& evt : m_queue )   {
+      for_each(evt.particles.begin(),evt.particles.end(),detail::deleteObject<Particle>);
+      for_each(evt.vertices.begin(),evt.vertices.end(),detail::deleteObject<Vertex>);
+    }
+  }
+  /// Take the next decoded event. Blocks until it is available. Returns false if nothing follows
+  bool next(Event& evt)   {
+    std::unique_lock<std::mutex> guard(m_lock);
+    m_haveEvents.wait(guard, [this] { return m_done || !m_queue.empty(); });
+    if ( m_queue.empty() ) return false;
+    evt = std::move(m_queue.front());
+    m_queue.pop_front();
+    m_haveSpace.notify_one();
+    return true;
+  }
+};
+
 
 /// Initializing constructor
 Geant4EventReader::Geant4EventReader(const std::string& nam) : m_name(nam)
@@ -39,6 +154,9 @@ Geant4EventReader::~Geant4EventReader()   {
 
 /// Get the context (from the input action)
 Geant4Context* Geant4EventReader::context() const {
+  if( s_prefetchContext ) {
+    return s_prefetchContext;
+  }
   if( 0 == m_inputAction ) {
     printout(FATAL,"Geant4EventReader", "No input action registered!");
     throw std::runtime_error("Geant4EventReader: No input action registered!");
@@ -127,6 +245,7 @@ Geant4InputAction::Geant4InputAction(Geant4Context* ctxt, const std::string& nam
   declareProperty("Parameters",     m_parameters = {});
   declareProperty("AlternativeDecayStatuses", m_alternativeDecayStatuses = {});
   declareProperty("AlternativeStableStatuses", m_alternativeStableStatuses = {});
+  declareProperty("Prefetch",       m_prefetch);
   m_needsControl = true;
 
   runAction().callAtBegin(this, &Geant4InputAction::beginRun);
@@ -134,6 +253,7 @@ Geant4InputAction::Geant4InputAction(Geant4Context* ctxt, const std::string& nam
 
 /// Default destructor
 Geant4InputAction::~Geant4InputAction()   {
+  m_prefetchStage.reset();
 }
 
 ///Intialize the event reader before the run starts
@@ -179,15 +299,8 @@ std::string Geant4InputAction::issue(int i)  const  {
   return str.str();
 }
 
-/// Read an event and return a LCCollection of MCParticles.
-int Geant4InputAction::readParticles(int evt_number,
-                                     Vertices& vertices,
-                                     std::vector<Particle*>& particles)
-{
-  //in case readParticles is called directly outside of having a run, we make sure a reader exists
-  createReader();
-  int evid = evt_number + m_firstEvent;
-  int status = m_reader->moveToEvent(evid);
+/// Handle the status of the event reader: abort or throw on errors
+int Geant4InputAction::handleReaderStatus(int evid, int status)   {
   if(status == Geant4EventReader::EVENT_READER_EOF ) {
     long nEvents = context()->kernel().property("NumEvents").value<long>();
     if(nEvents < 0) {
@@ -206,29 +319,55 @@ int Geant4InputAction::readParticles(int evt_number,
     }
     error(msg.c_str());
     except("Error when reading file %s.", m_input.c_str());
-    return status;
-  }
-  status = m_reader->readParticles(evid, vertices, particles);
-  if(status == Geant4EventReader::EVENT_READER_EOF ) {
-    long nEvents = context()->kernel().property("NumEvents").value<long>();
-    if(nEvents < 0) {
-      //context()->kernel().runManager().AbortRun(true);
-      throw DD4hep_End_Of_File();
-    }
   }
+  return status;
+}
 
-  if ( Geant4EventReader::EVENT_READER_OK != status )  {
-    std::string msg = issue(evid)+"Error when moving to event - ";
-    if ( status == Geant4EventReader::EVENT_READER_EOF ) msg += " EOF: [end of file].";
-    else msg += " Unknown error condition";
-    if ( m_abort )  {
-      abortRun(msg,"Error when reading file %s",m_input.c_str());
-      return status;
+/// Read an event and return a LCCollection of MCParticles.
+int Geant4InputAction::readParticles(int evt_number,
+                                     Vertices& vertices,
+                                     std::vector<Particle*>& particles)
+{
+  //in case readParticles is called directly outside of having a run, we make sure a reader exists
+  createReader();
+  int evid = evt_number + m_firstEvent;
+  if ( m_prefetch > 0 )  {
+    if ( !m_prefetchStage )  {
+      m_prefetchStage = std::make_unique<Prefetch>(m_reader, &context()->kernel(), m_prefetch, evid);
+      info("+++ Started read-ahead of %d events from %s", m_prefetch, m_input.c_str());
     }
-    error(msg.c_str());
-    except("Error when reading file %s.", m_input.c_str());
+    Prefetch::Event evt;
+    if ( !m_prefetchStage->next(evt) )  {
+      return handleReaderStatus(evid, Geant4EventReader::EVENT_READER_EOF);
+    }
+    if ( !evt.error.empty() )  {
+      except("Error when reading file %s: %s", m_input.c_str(), evt.error.c_str());
+    }
+    if ( evt.number != evid )  {
+      except("Read-ahead requires sequential access: requested event %d, next decoded event %d.",
+             evid, evt.number);
+    }
+    // Attach the event extensions created by the reader to the current event
+    Geant4Event& event = context()->event();
+    for( const auto& ext : evt.extensions->extensions )  {
+      if ( event.ObjectExtensions::extension(ext.first, false) )  {
+        warning("+++ Event %d: Drop reader extension already present in the event.", evid);
+        ext.second->destruct();
+        delete ext.second;
+        continue;
+      }
+      event.addExtension(ext.first, ext.second);
+    }
+    evt.extensions->extensions.clear();
+    vertices.insert(vertices.end(), evt.vertices.begin(), evt.vertices.end());
+    particles.insert(particles.end(), evt.particles.begin(), evt.particles.end());
+    return handleReaderStatus(evid, evt.status);
   }
-  return status;
+  int status = m_reader->moveToEvent(evid);
+  if ( Geant4EventReader::EVENT_READER_OK == status )  {
+    status = m_reader->readParticles(evid, vertices, particles);
+  }
+  return handleReaderStatus(evid, status);
 }
 
 /// Callback to generate primary particles
@@ -23,6 +23,7 @@
 #include <DDG4/Geant4Context.h>
 #include <DDG4/Geant4Interrupts.h>
 #include <DDG4/Geant4ActionPhase.h>
+#include <DDG4/Geant4ActionProfiler.h>
 
 // Geant4 include files
 #include <G4RunManager.hh>
@@ -36,6 +37,7 @@
 #include <pthread.h>
 #include <csignal>
 #include <memory>
+#include <mutex>
 
 using namespace dd4hep::sim;
 
@@ -43,6 +45,10 @@ namespace {
 
   G4Mutex kernel_mutex = G4MUTEX_INITIALIZER;
   Geant4Kernel* s_main_instance = nullptr;
+  /// Protection of the worker registry
+  std::mutex s_worker_lock;
+  /// Worker instance of the current thread
+  thread_local Geant4Kernel* s_thread_worker = nullptr;
   void description_unexpected()    {
     try  {
       throw;
@@ -97,10 +103,13 @@ Geant4Kernel::Geant4Kernel(Detector& description_ref)
   declareProperty("NumEvents",            m_numEvent = 10);
   declareProperty("OutputLevels",         m_clientLevels);
   declareProperty("NumberOfThreads",      m_numThreads = 0);
+  declareProperty("EventGrainsize",       m_eventGrainsize = 0);
   declareProperty("HaveScoringManager",   m_haveScoringMgr = false);
   declareProperty("SensitiveTypes",       m_sensitiveDetectorTypes);
   declareProperty("RunManagerType",       m_runManagerType = "G4RunManager");
   declareProperty("DefaultSensitiveType", m_dfltSensitiveDetectorType = "Geant4SensDet");
+  declareProperty("ProfileActions",       m_profileActions = 0);
+  declareProperty("ProfileReport",        m_profileReport);
   m_interrupts = new Geant4Interrupts(*this);
   m_controlName = "/ddg4/";
   m_control = new G4UIdirectory(m_controlName.c_str());
@@ -117,7 +126,7 @@ Geant4Kernel::Geant4Kernel(Geant4Kernel* krnl, unsigned long ident)
   m_numThreads     = 1; // Slave instance for one single thread
   m_detDesc        = m_master->m_detDesc;
   m_world          = m_master->m_world;
-  m_ident          = m_master->m_workers.size();
+  m_ident          = m_master->m_workers.size() + m_master->m_retiredWorkers.size();
   m_numEvent       = m_master->m_numEvent;
   m_runManagerType = m_master->m_runManagerType;
   m_sensitiveDetectorTypes      = m_master->m_sensitiveDetectorTypes;
@@ -125,7 +134,7 @@ Geant4Kernel::Geant4Kernel(Geant4Kernel* krnl, unsigned long ident)
   declareProperty("UI",m_uiName = m_master->m_uiName);
   declareProperty("OutputLevel",  m_outputLevel  = m_master->m_outputLevel);
   declareProperty("OutputLevels", m_clientLevels = m_master->m_clientLevels);
-  ::snprintf(text, sizeof(text), "/ddg4.%d/", (int)(m_master->m_workers.size()));
+  ::snprintf(text, sizeof(text), "/ddg4.%d/", int(m_ident));
   m_controlName = text;
   m_control = new G4UIdirectory(m_controlName.c_str());
   m_control->SetGuidance("Control for thread specific Geant4 actions");
@@ -139,6 +148,8 @@ Geant4Kernel::~Geant4Kernel() {
     s_main_instance = nullptr;
   }
   detail::destroyObjects(m_workers);
+  for( Geant4Kernel*& w : m_retiredWorkers ) detail::deletePtr(w);
+  m_retiredWorkers.clear();
   if ( isMaster() )  {
     detail::releaseObjects(m_globalFilters);
     detail::releaseObjects(m_globalActions);
@@ -217,8 +228,21 @@ unsigned long int Geant4Kernel::thread_self()    {
 Geant4Kernel& Geant4Kernel::createWorker()   {
   if ( isMaster() )   {
     unsigned long identifier = thread_self();
-    Geant4Kernel* w = new Geant4Kernel(this, identifier);
-    m_workers[identifier] = w;
+    Geant4Kernel* w = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(s_worker_lock);
+      // Task based run managers may end threads and start new ones. A new thread may
+      // reuse the identifier of a finished one: its worker is retired, but kept alive,
+      // since Geant4 objects of the finished thread may still refer to its actions.
+      if ( Workers::iterator i=m_workers.find(identifier); i != m_workers.end() )   {
+        m_retiredWorkers.emplace_back((*i).second);
+        printout(INFO, "Geant4Kernel", "+++ Retired worker instance %lu of recycled thread id=%ul",
+                 (*i).second->m_ident, identifier);
+      }
+      w = new Geant4Kernel(this, identifier);
+      m_workers[identifier] = w;
+    }
+    s_thread_worker = w;
     printout(INFO, "Geant4Kernel", "+++ Created worker instance id=%ul",identifier);
     return *w;
   }
@@ -228,21 +252,34 @@ Geant4Kernel& Geant4Kernel::createWorker()   {
 
 /// Access worker instance by its identifier
 Geant4Kernel& Geant4Kernel::worker(unsigned long identifier, bool create_if)    {
-  if ( Workers::iterator i=m_workers.find(identifier); i != m_workers.end() )   {
-    return *((*i).second);
-  }
-  else if ( identifier == m_id )  {
+  // The master thread (e.g. ConstructSDandField on the master) uses the master instance
+  if ( identifier == m_id )  {
     return *this;
   }
-  else if ( !isMultiThreaded() )  {
+  if ( identifier == thread_self() && isMultiThreaded() )   {
+    // The worker created by this thread: valid for the lifetime of the thread
+    if ( s_thread_worker && s_thread_worker->m_master == this )   {
+      return *s_thread_worker;
+    }
+    // A thread without worker. Any registered worker with this identifier
+    // belongs to a finished thread and must not be shared.
+    else if ( create_if )  {
+      return createWorker();
+    }
+    except("Geant4Kernel", "DDG4: The thread 0x%p has no worker kernel object!",(void*)identifier);
+  }
+  {
+    std::lock_guard<std::mutex> lock(s_worker_lock);
+    if ( Workers::iterator i=m_workers.find(identifier); i != m_workers.end() )   {
+      return *((*i).second);
+    }
+  }
+  if ( !isMultiThreaded() )  {
     unsigned long self = thread_self();
     if ( identifier == self )  {
       return *this;
     }
   }
-  else if( create_if )  {
-    return createWorker();
-  }
   except("Geant4Kernel", "DDG4: The Kernel object 0x%p does not exists!",(void*)identifier);
   throw std::runtime_error("Geant4Kernel::worker");
 }
@@ -334,6 +371,9 @@ G4RunManager& Geant4Kernel::runManager() {
              m_runManagerType.c_str());
     }
     mgr->property("NumberOfThreads").set(m_numThreads);
+    if ( mgr->hasProperty("EventGrainsize") )  {
+      mgr->property("EventGrainsize").set(m_eventGrainsize);
+    }
     mgr->enableUI();
     if ( this->m_haveScoringMgr )  {
       if ( nullptr == G4ScoringManager::GetScoringManager() )  {
@@ -393,6 +433,9 @@ void Geant4Kernel::register_terminate(const std::function<void()>& callback)  {
 
 /// Configure Geant4 kernel object
 int Geant4Kernel::configure() {
+  if ( m_profileActions > 0 )  {
+    Geant4ActionProfiler::enable(m_profileActions);
+  }
   int status = Geant4Exec::configure(*this);
   if ( status )   {
     for(auto& call : m_actionConfigure) call();
@@ -419,6 +462,7 @@ int Geant4Kernel::run() {
     auto result = Geant4Exec::run(*this);
     // flush the geant4 stream buffer
     G4cout << G4endl;
+    printProfile();
     return result;
   }
   catch(const std::exception& e)   {
@@ -432,7 +476,19 @@ int Geant4Kernel::run() {
 
 int Geant4Kernel::runEvents(int num_events) {
   m_numEvent = num_events;
-  return Geant4Exec::run(*this);
+  int result = Geant4Exec::run(*this);
+  printProfile();
+  return result;
+}
+
+/// Print the action profile and write the report if the profiler is enabled
+void Geant4Kernel::printProfile()  const  {
+  if ( Geant4ActionProfiler::active() )  {
+    Geant4ActionProfiler::print();
+    if ( !m_profileReport.empty() )  {
+      Geant4ActionProfiler::writeJSON(m_profileReport);
+    }
+  }
 }
 
 int Geant4Kernel::terminate() {
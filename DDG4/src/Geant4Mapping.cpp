@@ -86,10 +86,5 @@ Geant4VolumeManager Geant4Mapping::volumeManager() const {
 /// Accessor to resolve geometry placements
 dd4hep::PlacedVolume Geant4Mapping::placement(const G4VPhysicalVolume* node) const {
   checkValidity();
-  const Geant4GeometryMaps::PlacementMap& pm = m_dataPtr->g4Placements;
-  for ( const auto& entry : pm )  {
-    if ( entry.second == node )
-      return PlacedVolume(entry.first);
-  }
-  return PlacedVolume(0);
+  return m_dataPtr->placement(node);
 }
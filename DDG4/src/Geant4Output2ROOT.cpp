@@ -15,6 +15,7 @@
 #include <DD4hep/Printout.h>
 #include <DD4hep/InstanceCount.h>
 #include <DDG4/Geant4HitCollection.h>
+#include <DDG4/Geant4SensDetAction.h>
 #include <DDG4/Geant4Output2ROOT.h>
 #include <DDG4/Geant4Particle.h>
 #include <DDG4/Geant4Data.h>
@@ -22,16 +23,49 @@
 // Geant4 include files
 #include <G4HCofThisEvent.hh>
 #include <G4ParticleTable.hh>
+#include <G4AutoLock.hh>
 #include <G4Run.hh>
 
 // ROOT include files
 #include <TFile.h>
 #include <TTree.h>
+#include <TROOT.h>
 #include <TBranch.h>
 #include <TSystem.h>
+#include <RVersion.h>
+#include <ROOT/TBufferMerger.hxx>
+
+// C/C++ include files
+#include <algorithm>
 
 using namespace dd4hep::sim;
 
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,26,0)
+using TBufferMerger     = ROOT::TBufferMerger;
+using TBufferMergerFile = ROOT::TBufferMergerFile;
+#else
+using TBufferMerger     = ROOT::Experimental::TBufferMerger;
+using TBufferMergerFile = ROOT::Experimental::TBufferMergerFile;
+#endif
+
+/// Output buffer of the instance in buffer merger mode
+struct Geant4Output2ROOT::MergerOutput  {
+  /// Merger shared by all instances writing the same file
+  std::shared_ptr<TBufferMerger>     merger;
+  /// Memory file of this instance. Must be released before the merger
+  std::shared_ptr<TBufferMergerFile> file;
+  /// Number of events filled since the last hand-over to the merger
+  int                                events { 0 };
+};
+
+namespace {
+  G4Mutex merger_mutex = G4MUTEX_INITIALIZER;
+  /// Mergers by output file name. Protected by the merger_mutex
+  std::map<std::string, std::weak_ptr<TBufferMerger> > s_mergers;
+  /// Flag if the ROOT thread safety was enabled. Protected by the merger_mutex
+  bool s_rootThreadSafety = false;
+}
+
 /// Standard constructor
 Geant4Output2ROOT::Geant4Output2ROOT(Geant4Context* ctxt, const std::string& nam)
   : Geant4OutputAction(ctxt, nam) {
@@ -40,6 +74,9 @@ Geant4Output2ROOT::Geant4Output2ROOT(Geant4Context* ctxt, const std::string& nam
   declareProperty("DisabledCollections",  m_disabledCollections);
   declareProperty("DisableParticles",     m_disableParticles);
   declareProperty("FilesByRun",           m_filesByRun);
+  declareProperty("BufferMerger",         m_bufferMerger);
+  declareProperty("FlushEvents",          m_flushEvents);
+  declareProperty("ImplicitMT",           m_implicitMT);
   InstanceCount::increment(this);
 }
 
@@ -49,8 +86,28 @@ Geant4Output2ROOT::~Geant4Output2ROOT() {
   InstanceCount::decrement(this);
 }
 
+/// Access the directory of the current output (file or merger buffer)
+TDirectory* Geant4Output2ROOT::outputDirectory()  const  {
+  if ( m_merger ) return m_merger->file.get();
+  return m_file.get();
+}
+
 /// Close current output file
 void Geant4Output2ROOT::closeOutput()   {
+  if ( m_merger )   {
+    TDirectory::TContext ctxt(m_merger->file.get());
+    info("+++ Closing ROOT output buffer of %s", m_merger->file->GetName());
+    m_sections.clear();
+    m_branches.clear();
+    m_merger->file->Write();
+    m_tree = nullptr;
+    {
+      // The last instance releasing the merger writes and closes the output file
+      G4AutoLock protection_lock(&merger_mutex);
+      m_merger.reset();
+    }
+    return;
+  }
   if (!m_file) return;
   TDirectory::TContext ctxt(m_file.get());
   info("+++ Closing ROOT output file %s", m_file->GetName());
@@ -66,7 +123,7 @@ void Geant4Output2ROOT::closeOutput()   {
 TTree* Geant4Output2ROOT::section(const std::string& nam) {
   auto i = m_sections.find(nam);
   if (i == m_sections.end()) {
-    TDirectory::TContext ctxt(m_file.get());
+    TDirectory::TContext ctxt(outputDirectory());
     TTree* t = new TTree(nam.c_str(), ("Geant4 " + nam + " information").c_str());
     m_sections.emplace(nam, t);
     return t;
@@ -79,14 +136,40 @@ void Geant4Output2ROOT::beginRun(const G4Run* run) {
   std::string fname = m_output;
   if ( m_filesByRun )    {
     size_t idx = m_output.rfind(".");
-    if ( m_file )
+    if ( m_tree )
       closeOutput();
     fname  = m_output.substr(0, idx);
     fname += _toString(run->GetRunID(), ".run%08d");
     if ( idx != std::string::npos )
       fname += m_output.substr(idx);
   }
-  if ( !m_file && !fname.empty() ) {
+  if ( !m_tree && !fname.empty() && m_bufferMerger ) {
+    G4AutoLock protection_lock(&merger_mutex);
+    if ( !s_rootThreadSafety )  {
+      ROOT::EnableThreadSafety();
+      s_rootThreadSafety = true;
+    }
+    if ( m_implicitMT > 0 && !ROOT::IsImplicitMTEnabled() )  {
+      ROOT::EnableImplicitMT(m_implicitMT);
+    }
+    auto output = std::make_unique<MergerOutput>();
+    output->merger = s_mergers[fname].lock();
+    if ( !output->merger )  {
+      try  {
+        output->merger = std::make_shared<TBufferMerger>(fname.c_str(), "RECREATE");
+      }
+      catch(const std::exception& e)  {
+        except("Failed to create ROOT output file:'%s' [%s]", fname.c_str(), e.what());
+      }
+      s_mergers[fname] = output->merger;
+      info("+++ Opened ROOT output file %s with buffer merger.", fname.c_str());
+    }
+    output->file = output->merger->GetFile();
+    m_merger = std::move(output);
+    m_tree = section(m_section);
+    declareBranches();
+  }
+  else if ( !m_tree && !fname.empty() ) {
     TDirectory::TContext ctxt(TDirectory::CurrentDirectory());
     if ( !gSystem->AccessPathName(fname.c_str()) )  {
       gSystem->Unlink(fname.c_str());
@@ -107,25 +190,48 @@ void Geant4Output2ROOT::beginRun(const G4Run* run) {
   Geant4OutputAction::beginRun(run);
 }
 
-/// Fill single EVENT branch entry (Geant4 collection data)
-int Geant4Output2ROOT::fill(const std::string& nam, const ComponentCast& type, void* ptr) {
-  if (!m_file) return 0;
-  TBranch* b = nullptr;
+/// Create/access the event tree branch of a collection
+TBranch* Geant4Output2ROOT::branch(const std::string& nam, const ComponentCast& type) {
   auto i = m_branches.find(nam);
-  if (i == m_branches.end()) {
-    const std::type_info& typ = type.type();
-    if (auto* cl = TBuffer::GetClass(typ)) {
-      b = m_tree->Branch(nam.c_str(), cl->GetName(), static_cast<void*>(nullptr));
-      b->SetAutoDelete(false);
-      m_branches.emplace(nam, b);
-    }
-    else {
-      throw std::runtime_error("No ROOT TClass object available for object type:" + typeName(typ));
+  if (i != m_branches.end()) {
+    return i->second;
+  }
+  const std::type_info& typ = type.type();
+  if (auto* cl = TBuffer::GetClass(typ)) {
+    TBranch* b = m_tree->Branch(nam.c_str(), cl->GetName(), static_cast<void*>(nullptr));
+    b->SetAutoDelete(false);
+    m_branches.emplace(nam, b);
+    return b;
+  }
+  throw std::runtime_error("No ROOT TClass object available for object type:" + typeName(typ));
+}
+
+/// Declare the branches of all collections, which may be written during the run
+void Geant4Output2ROOT::declareBranches() {
+  if (!m_disableParticles) {
+    branch("MCParticles", Geant4HitWrapper::manipulator<Geant4Particle>()->vec_type);
+  }
+  for (const auto& seq : context()->sensitiveActions().sequences()) {
+    for (const auto& coll : seq.second->collections()) {
+      const auto& disabled = m_disabledCollections;
+      if (std::find(disabled.begin(), disabled.end(), coll.first) != disabled.end())
+        continue;
+      // The collection type is only known to the creator of the collection
+      std::unique_ptr<Geant4HitCollection> hits((*coll.second.second)(seq.first, coll.first, coll.second.first));
+      branch(coll.first, hits->vector_type());
     }
   }
-  else {
-    b = i->second;
+}
+
+/// Fill single EVENT branch entry (Geant4 collection data)
+int Geant4Output2ROOT::fill(const std::string& nam, const ComponentCast& type, void* ptr) {
+  if (!m_tree) return 0;
+  if (m_merger && m_branches.find(nam) == m_branches.end()) {
+    // A branch added now would be missing in the buffers already handed to the merger
+    except("+++ Collection %s was not declared at the begin of the run. "
+           "It cannot be written with the buffer merger.", nam.c_str());
   }
+  TBranch* b = branch(nam, type);
   const Long64_t evt  = b->GetEntries();
   const Long64_t nevt = b->GetTree()->GetEntries();
   if (nevt > evt) {
@@ -143,7 +249,7 @@ int Geant4Output2ROOT::fill(const std::string& nam, const ComponentCast& type, v
 
 /// Commit data at end of filling procedure
 void Geant4Output2ROOT::commit(OutputContext<G4Event>& ctxt) {
-  if (m_file) {
+  if (m_tree) {
     auto* a = m_tree->GetListOfBranches();
     const Long64_t evt = m_tree->GetEntries() + 1;
     const Int_t nb = a->GetEntriesFast();
@@ -158,6 +264,12 @@ void Geant4Output2ROOT::commit(OutputContext<G4Event>& ctxt) {
       }
     }
     m_tree->SetEntries(evt);
+    // Hand the buffer over to the merger. Afterwards the trees are empty again.
+    if ( m_merger && ++m_merger->events >= m_flushEvents )  {
+      TDirectory::TContext dir_ctxt(m_merger->file.get());
+      m_merger->file->Write();
+      m_merger->events = 0;
+    }
   }
   Geant4OutputAction::commit(ctxt);
 }
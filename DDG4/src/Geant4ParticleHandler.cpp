@@ -15,6 +15,7 @@
 #include <DD4hep/Primitives.h>
 #include <DD4hep/InstanceCount.h>
 #include <DDG4/Geant4StepHandler.h>
+#include <DDG4/Geant4StepContext.h>
 #include <DDG4/Geant4TrackHandler.h>
 #include <DDG4/Geant4EventAction.h>
 #include <DDG4/Geant4SensDetAction.h>
@@ -37,6 +38,7 @@
 
 // C/C++ include files
 #include <set>
+#include <new>
 #include <algorithm>
 
 using namespace dd4hep::sim;
@@ -81,6 +83,9 @@ Geant4ParticleHandler::Geant4ParticleHandler()
 /// Default destructor
 Geant4ParticleHandler::~Geant4ParticleHandler()  {
   clear();
+  for( auto* p : m_particlePool )
+    delete p;
+  m_particlePool.clear();
   for( auto* h : this->m_userHandlers )
     detail::releasePtr(h);
   this->m_userHandlers.clear();
@@ -110,11 +115,52 @@ bool Geant4ParticleHandler::adopt(Geant4Action* action)    {
 void Geant4ParticleHandler::clear()  {
   detail::releaseObjects(m_particleMap);
   m_particleMap.clear();
+  for( auto* p : m_particles )
+    if ( p ) releaseParticle(p);
+  // Keep the allocated memory of the event store for the next event
+  m_particles.clear();
+  m_equivalents.clear();
   // m_suspendedPM should already be empty and cleared...
   assert(m_suspendedPM.empty() && "There was something wrong with the particle record treatment, please open a bug report!");
   m_equivalentTracks.clear();
 }
 
+/// Create a new particle object. Pooled objects are reused
+Geant4ParticleHandler::Particle* Geant4ParticleHandler::newParticle()  {
+  if ( m_particlePool.empty() )
+    return new Particle();
+  Particle* p = m_particlePool.back();
+  m_particlePool.pop_back();
+  return p;
+}
+
+/// Release a particle object. Objects not referenced elsewhere are returned to the pool
+void Geant4ParticleHandler::releaseParticle(Particle* p)  {
+  if ( p->ref == 1 )  {
+    // Reset the object to the default state. Releases the parent/daughter sets and the extension
+    p->~Particle();
+    new(p) Particle();
+    m_particlePool.emplace_back(p);
+    return;
+  }
+  p->release();
+}
+
+/// Convert the event store to the particle map and the track equivalents
+void Geant4ParticleHandler::fillParticleMap()  {
+  m_particleMap.clear();
+  m_equivalentTracks.clear();
+  for( std::size_t i = 0; i < m_particles.size(); ++i )  {
+    if ( m_particles[i] ) m_particleMap.emplace_hint(m_particleMap.end(), int(i), m_particles[i]);
+  }
+  for( std::size_t i = 0; i < m_equivalents.size(); ++i )  {
+    if ( m_equivalents[i] >= 0 ) m_equivalentTracks.emplace_hint(m_equivalentTracks.end(), int(i), m_equivalents[i]);
+  }
+  // The particles are now owned by the particle map
+  m_particles.clear();
+  m_equivalents.clear();
+}
+
 /// Mark a Geant4 track to be kept for later MC truth analysis
 void Geant4ParticleHandler::mark(const G4Track* track, int reason)   {
   if ( track )   {
@@ -152,20 +198,14 @@ void Geant4ParticleHandler::mark(const G4Track* track)   {
   // If yes, flag it, because it is a candidate for removal.
   G4LogicalVolume*      vol = track->GetVolume()->GetLogicalVolume();
   // Volume is never null since track is always within the world volume
+  // The sensitive type of the last detector is cached by the thread's step context
   G4VSensitiveDetector*  g4 = vol->GetSensitiveDetector();
-  Geant4ActionSD*        sd = dynamic_cast<Geant4ActionSD*>(g4);
-  if( sd )  {
-    std::string typ = sd->sensitiveType();
-
-    if ( typ == "calorimeter" )  {
-      mask.set( G4PARTICLE_CREATED_CALORIMETER_HIT );
-    }
-    else if ( typ == "tracker" )  {
-      mask.set( G4PARTICLE_CREATED_TRACKER_HIT );
-    }
-    else  { // Assume by default "tracker"
-      mask.set( G4PARTICLE_CREATED_TRACKER_HIT );
-    }
+  int                    typ = g4 ? Geant4StepContext::instance().sensitiveType(g4) : Geant4StepContext::SD_NONE;
+  if ( typ == Geant4StepContext::SD_CALORIMETER )  {
+    mask.set( G4PARTICLE_CREATED_CALORIMETER_HIT );
+  }
+  else if ( typ == Geant4StepContext::SD_TRACKER )  { // Default: "tracker"
+    mask.set( G4PARTICLE_CREATED_TRACKER_HIT );
   }
   if( !this->m_userHandlers.empty() )  {
     for( auto* h : this->m_userHandlers )
@@ -220,13 +260,12 @@ void Geant4ParticleHandler::begin(const G4Track* track)   {
   // if particles are not tracked to the end, we pick up where we stopped previously
   if ( m_haveSuspended )  {
     // primary particles are already in the particle map, we don't have to store them in another map
-    auto existingParticle = m_particleMap.find(h.id());
-    if ( existingParticle != m_particleMap.end() )  {
-      m_currTrack.get_data(*(existingParticle->second));
+    if ( Particle* p = particle(h.id()) )  {
+      m_currTrack.get_data(*p);
       return;
     }
     //other particles might not be in the particleMap yet, so we take them from here
-    existingParticle = m_suspendedPM.find(h.id());
+    auto existingParticle = m_suspendedPM.find(h.id());
     if ( existingParticle != m_suspendedPM.end() ) {
       m_currTrack.get_data(*(existingParticle->second));
       // make sure we delete a suspended particle in the map, fill it back later...
@@ -242,7 +281,7 @@ void Geant4ParticleHandler::begin(const G4Track* track)   {
       except("+++ Tracking preaction: Primary particle without generator particle!");
     }
     reason |= (G4PARTICLE_PRIMARY|G4PARTICLE_ABOVE_ENERGY_THRESHOLD);
-    m_particleMap[h.id()] = prim_part->addRef();
+    particleSlot(h.id()) = prim_part->addRef();
   }
 
   if ( prim_part )   {
@@ -314,11 +353,8 @@ void Geant4ParticleHandler::begin(const G4Track* track)   {
   G4LogicalVolume* vol = track->GetVolume()->GetLogicalVolume();
   // Volume is never null since track is always within the world volume
   G4VSensitiveDetector* g4 = vol->GetSensitiveDetector();
-  if( Geant4ActionSD* sd = dynamic_cast<Geant4ActionSD*>(g4) )  {
-    std::string typ = sd->sensitiveType();
-    if( typ == "calorimeter" )  {
-      mask.set( G4PARTICLE_STARTED_IN_CALORIMETER );
-    }
+  if( g4 && Geant4StepContext::instance().sensitiveType(g4) == Geant4StepContext::SD_CALORIMETER )  {
+    mask.set( G4PARTICLE_STARTED_IN_CALORIMETER );
   }
 
   /// Initial update of the particle using the user handler
@@ -398,19 +434,17 @@ void Geant4ParticleHandler::end(const G4Track* track)   {
   Geant4ParticleInformation* track_info =
     dynamic_cast<Geant4ParticleInformation*>(track->GetUserInformation());
   if( !mask.isNull() || track_info || reason_mask.isSet(G4PARTICLE_SIM_BACKSCATTER) )  {
-    m_equivalentTracks[g4_id] = g4_id;
-    ParticleMap::iterator ip = m_particleMap.find(g4_id);
+    setEquivalent(g4_id, g4_id);
+    Particle*& part = particleSlot(g4_id);
     if( mask.isSet(G4PARTICLE_PRIMARY) )  {
-      ph.dump2(outputLevel()-1,name(),"Add Primary", h.id(), ip != m_particleMap.end());
+      ph.dump2(outputLevel()-1,name(),"Add Primary", h.id(), part != nullptr);
     }
     if( reason_mask.isSet(G4PARTICLE_SIM_BACKSCATTER) )  {
       mask.set(G4PARTICLE_KEEP_ALWAYS);
       info("+++ Track: %6d Particle back-scattering to tracker --> keep particle in MC history.", g4_id);
     }
     // Create a new MC particle from the current track information saved in the pre-tracking action
-    Particle* part = 0;
-    if( ip==m_particleMap.end() ) part = m_particleMap[g4_id] = new Particle();
-    else part = (*ip).second;
+    if( !part ) part = newParticle();
     if( track_info )  {
       mask.set(G4PARTICLE_KEEP_USER);
       part->extension.reset(track_info->release());
@@ -423,17 +457,16 @@ void Geant4ParticleHandler::end(const G4Track* track)   {
     // We will not store them on the record, but have to memorise the
     // track identifier in order to restore the history for the created hits.
     int pid = m_currTrack.g4Parent;
-    m_equivalentTracks[g4_id] = pid;
+    setEquivalent(g4_id, pid);
     // Need to find the last stored particle and OR this particle's mask
     // with the mask of the last stored particle
-    auto iend = m_equivalentTracks.end(), iequiv=m_equivalentTracks.end();
-    ParticleMap::iterator ip;
-    for(ip=m_particleMap.find(pid); ip == m_particleMap.end(); ip=m_particleMap.find(pid))  {
-      if (iequiv=m_equivalentTracks.find(pid); iequiv == iend) break;  // ERROR
-      pid = (*iequiv).second;
+    Particle* par = particle(pid);
+    for( int equiv = equivalent(pid); !par && equiv >= 0; equiv = equivalent(pid) )  {
+      pid = equiv;
+      par = particle(pid);
     }
-    if ( ip != m_particleMap.end() )
-      (*ip).second->reason |= track_reason;
+    if ( par )
+      par->reason |= track_reason;
     else
       ph.dumpWithVertex(outputLevel()+3,name(),"FATAL: No real particle parent present");
   }
@@ -441,7 +474,7 @@ void Geant4ParticleHandler::end(const G4Track* track)   {
   if( track->GetTrackStatus() == fSuspend ) {
     m_haveSuspended = true;
     //track is already in particle map, we pick it up from there in begin again
-    if(m_particleMap.find(g4_id) != m_particleMap.end()) return;
+    if( particle(g4_id) ) return;
     //track is not already stored, keep it in special map
     auto iPart = m_suspendedPM.emplace(g4_id, new Particle());
     (iPart.first->second)->get_data(m_currTrack);
@@ -458,6 +491,8 @@ void Geant4ParticleHandler::beginEvent(const G4Event* event)  {
   m_globalParticleID = interaction->nextPID();
   m_particleMap.clear();
   m_equivalentTracks.clear();
+  m_particles.clear();
+  m_equivalents.clear();
   /// Call the user particle handler
   for( auto* h : this->m_userHandlers )
     h->begin(event);
@@ -467,8 +502,8 @@ void Geant4ParticleHandler::beginEvent(const G4Event* event)  {
 void Geant4ParticleHandler::dumpMap(const char* tag)  const  {
   const std::string& n = name();
   Geant4ParticleHandle::header4(INFO,n,tag);
-  for(ParticleMap::const_iterator iend=m_particleMap.end(), i=m_particleMap.begin(); i!=iend; ++i)  {
-    Geant4ParticleHandle((*i).second).dump4(INFO,n,tag);
+  for( auto* p : m_particles )  {
+    if ( p ) Geant4ParticleHandle(p).dump4(INFO,n,tag);
   }
 }
 
@@ -478,7 +513,7 @@ void Geant4ParticleHandler::endEvent(const G4Event* event)  {
   int level = outputLevel();
   do {
     if ( level <= VERBOSE ) dumpMap("Particle  ");
-    debug("+++ Iteration:%d Tracks:%d Equivalents:%d",++count,m_particleMap.size(),m_equivalentTracks.size());
+    debug("+++ Iteration:%d Tracks:%d Equivalents:%d",++count,m_particles.size(),m_equivalents.size());
   } while( recombineParents() > 0 );
 
   if ( level <= VERBOSE ) dumpMap(  "Recombined");
@@ -494,6 +529,7 @@ void Geant4ParticleHandler::endEvent(const G4Event* event)  {
 
   // Now export the data to the final record.
   Geant4ParticleMap* part_map = context()->event().extension<Geant4ParticleMap>();
+  fillParticleMap();
   part_map->adopt(m_particleMap, m_equivalentTracks);
   m_primaryMap = 0;
   clear();
@@ -502,9 +538,10 @@ void Geant4ParticleHandler::endEvent(const G4Event* event)  {
 /// Rebase the simulated tracks, so that they fit to the generator particles
 void Geant4ParticleHandler::rebaseSimulatedTracks(int )   {
   /// No we have to update the map of equivalent tracks and assign the 'equivalentTrack' entry
-  TrackEquivalents equivalents, orgParticles;
-  ParticleMap      finalParticles;
-  ParticleMap::const_iterator ipar, iend, i;
+  /// Both tables are indexed: finalParticles by the new particle identifier,
+  /// equivalents by the geant4 track identifier.
+  std::vector<Particle*> finalParticles;
+  std::vector<int>       equivalents(m_equivalents.size(), -1);
   int count;
 
   Geant4PrimaryInteraction* interaction = context()->event().extension<Geant4PrimaryInteraction>();
@@ -512,40 +549,43 @@ void Geant4ParticleHandler::rebaseSimulatedTracks(int )   {
 
   // (1.0) Copy the pre-defined particle mapping for the simulated tracks
   //       It is assumed the mapping is ZERO based without holes.
-  for(count = 0, iend=pm.end(), i=pm.begin(); i!=iend; ++i)  {
-    Particle* p = (*i).second;
-    orgParticles[p->id] = p->id;
-    finalParticles[p->id] = p;
+  count = 0;
+  for( const auto& i : pm )  {
+    Particle* p = i.second;
     if ( p->id > count ) count = p->id;
+  }
+  finalParticles.reserve(count + 1 + m_particles.size());
+  finalParticles.resize(count + 1, nullptr);
+  for( const auto& i : pm )  {
+    Particle* p = i.second;
+    finalParticles[p->id] = p;
     if ( (p->reason&G4PARTICLE_PRIMARY) != G4PARTICLE_PRIMARY )  {
       p->addRef();
     }
   }
   // (1.1) Define the new particle mapping for the simulated tracks
-  for(++count, iend=m_particleMap.end(), i=m_particleMap.begin(); i!=iend; ++i)  {
-    Particle* p = (*i).second;
-    if ( (p->reason&G4PARTICLE_PRIMARY) != G4PARTICLE_PRIMARY )  {
-      //if ( orgParticles.find(p->id) == orgParticles.end() )  {
-      orgParticles[p->id] = count;
-      finalParticles[count] = p;
+  ++count;
+  for( auto* p : m_particles )  {
+    if ( p && (p->reason&G4PARTICLE_PRIMARY) != G4PARTICLE_PRIMARY )  {
+      finalParticles.emplace_back(p);
       p->id = count;
       ++count;
     }
   }
   // (2) Re-evaluate the corresponding geant4 track equivalents using the new mapping
-  for(TrackEquivalents::iterator ie=m_equivalentTracks.begin(),ie_end=m_equivalentTracks.end(); ie!=ie_end; ++ie)  {
-    int g4_equiv = (*ie).first;
-    while( (ipar=m_particleMap.find(g4_equiv)) == m_particleMap.end() )  {
-      TrackEquivalents::const_iterator iequiv = m_equivalentTracks.find(g4_equiv);
-      if ( iequiv == ie_end )  {
-        break;  // ERROR !! Will be handled by printout below because ipar==end()
-      }
-      g4_equiv = (*iequiv).second;
-    }
-    TrackEquivalents::mapped_type equiv = (*ie).second;
-    if ( ipar != m_particleMap.end() )   {
-      Geant4ParticleHandle p = (*ipar).second;
-      equivalents[(*ie).first] = p->id;  // requires (1) to be filled properly!
+  for( std::size_t g4_id = 0; g4_id < m_equivalents.size(); ++g4_id )  {
+    int equiv = m_equivalents[g4_id];
+    if ( equiv < 0 ) continue;
+    int g4_equiv = int(g4_id);
+    Particle* par = particle(g4_equiv);
+    for( int e = equivalent(g4_equiv); !par && e >= 0; e = equivalent(g4_equiv) )  {
+      g4_equiv = e;
+      par = particle(g4_equiv);
+    }
+    // If the chain is broken par==nullptr: handled by the printout below
+    if ( par )   {
+      Geant4ParticleHandle p = par;
+      equivalents[g4_id] = p->id;  // requires (1) to be filled properly!
       const G4ParticleDefinition* def = p.definition();
       int pdg = int(std::abs(def->GetPDGEncoding())+0.1);
       if ( pdg != 0 && pdg<36 && !(pdg > 10 && pdg < 17) && pdg != 22 )  {
@@ -567,16 +607,14 @@ void Geant4ParticleHandler::rebaseSimulatedTracks(int )   {
   // Note:
   //     We rely here on the ordering of the particles accoding to their
   //     Processing by Geant4 to establish mother daughter relationships.
-  //     == > use finalParticles map and NOT m_particleMap.
+  //     == > use finalParticles and NOT m_particles.
   int equiv_id = -1;
-  for( auto& part : finalParticles )  {
-    auto& p = part.second;
-    if ( p->g4Parent > 0 )  {
-      TrackEquivalents::iterator iequ = equivalents.find(p->g4Parent);
-      if ( iequ != equivalents.end() )  {
-        equiv_id = (*iequ).second;//equivalents[p->g4Parent];
-        if ( (ipar=finalParticles.find(equiv_id)) != finalParticles.end() )  {
-          Particle* q = (*ipar).second;
+  for( auto* p : finalParticles )  {
+    if ( p && p->g4Parent > 0 )  {
+      if ( std::size_t(p->g4Parent) < equivalents.size() && equivalents[p->g4Parent] >= 0 )  {
+        equiv_id = equivalents[p->g4Parent];
+        if ( std::size_t(equiv_id) < finalParticles.size() && finalParticles[equiv_id] )  {
+          Particle* q = finalParticles[equiv_id];
           bool      prim = (p->reason&G4PARTICLE_PRIMARY) == G4PARTICLE_PRIMARY;
           // We assume that the mother daughter relationship
           // is filled by the event readers!
@@ -623,8 +661,8 @@ void Geant4ParticleHandler::rebaseSimulatedTracks(int )   {
     }
   }
 #endif
-  m_equivalentTracks = std::move(equivalents);
-  m_particleMap = std::move(finalParticles);
+  m_equivalents = std::move(equivalents);
+  m_particles   = std::move(finalParticles);
 }
 
 /// Default callback to be answered if the particle should be kept if NO user handler is installed
@@ -662,11 +700,12 @@ bool Geant4ParticleHandler::defaultDropParticle(const Particle& particle)   {
 /// Clean the monte carlo record. Remove all unwanted stuff.
 /// This is the core of the object executed at the end of each event action.
 int Geant4ParticleHandler::recombineParents()  {
-  std::set<int> remove;
+  std::vector<int> remove;
 
   /// Need to start from BACK, to clean first the latest produced stuff.
-  for(ParticleMap::reverse_iterator i=m_particleMap.rbegin(); i!=m_particleMap.rend(); ++i)  {
-    Particle* p = (*i).second;
+  for( int g4_id = int(m_particles.size())-1; g4_id >= 0; --g4_id )  {
+    Particle* p = m_particles[g4_id];
+    if ( !p ) continue;
     PropertyMask mask(p->reason);
     // Allow the user to force the particle handling either by
     // or the reason mask with G4PARTICLE_KEEP_USER or
@@ -704,8 +743,7 @@ int Geant4ParticleHandler::recombineParents()  {
       //continue;
     }
     else if ( mask.isSet(G4PARTICLE_KEEP_PROCESS) )  {
-      if(ParticleMap::iterator ip = m_particleMap.find(p->g4Parent); ip != m_particleMap.end() )   {
-        Particle* parent_part = (*ip).second;
+      if( Particle* parent_part = particle(p->g4Parent) )   {
         PropertyMask parent_mask(parent_part->reason);
         if ( parent_mask.isSet(G4PARTICLE_ABOVE_ENERGY_THRESHOLD) )   {
           parent_mask.set(G4PARTICLE_KEEP_PARENT);
@@ -718,11 +756,9 @@ int Geant4ParticleHandler::recombineParents()  {
 
     /// Remove this track from the list and also do the cleanup in the parent's children list
     if ( remove_me )  {
-      int g4_id = (*i).first;
-      remove.insert(g4_id);
-      m_equivalentTracks[g4_id] = p->g4Parent;
-      if(ParticleMap::iterator ip = m_particleMap.find(p->g4Parent); ip != m_particleMap.end() )   {
-        Particle* parent_part = (*ip).second;
+      remove.emplace_back(g4_id);
+      setEquivalent(g4_id, p->g4Parent);
+      if( Particle* parent_part = particle(p->g4Parent) )   {
         PropertyMask(parent_part->reason).set(mask.value());
         parent_part->steps += p->steps;
         parent_part->secondaries += p->secondaries;
@@ -733,10 +769,8 @@ int Geant4ParticleHandler::recombineParents()  {
     }
   }
   for( int r : remove )  {
-    if( auto ir = m_particleMap.find(r); ir != m_particleMap.end() )  {
-      (*ir).second->release();
-      m_particleMap.erase(ir);
-    }
+    releaseParticle(m_particles[r]);
+    m_particles[r] = nullptr;
   }
   return int(remove.size());
 }
@@ -746,16 +780,15 @@ void Geant4ParticleHandler::checkConsistency()  const   {
   int num_errors = 0;
 
   /// First check the consistency of the particle map itself
-  for(const auto& part : m_particleMap )  {
-    Geant4Particle* particle = part.second;
-    Geant4ParticleHandle p(particle);
+  for( auto* part : m_particles )  {
+    if ( !part ) continue;
+    Geant4ParticleHandle p(part);
     PropertyMask mask(p->reason);
     PropertyMask status(p->status);
     std::set<int>& daughters = p->daughters;
-    ParticleMap::const_iterator j;
     // For all particles, the set of daughters must be contained in the record.
     for( int id_dau : daughters )   {
-      if ( j=m_particleMap.find(id_dau); j == m_particleMap.end() )   {
+      if ( !particle(id_dau) )   {
         ++num_errors;
         error("+++ Particle:%d Daughter %d is not in particle map!",p->id,id_dau);
       }
@@ -765,9 +798,9 @@ void Geant4ParticleHandler::checkConsistency()  const   {
     if ( !mask.isSet(G4PARTICLE_PRIMARY) && !status.anySet(G4PARTICLE_GEN_STATUS) )  {
       bool in_map = false, in_parent_list = false;
       int  parent_id = -1;
-      if( auto eq_it=m_equivalentTracks.find(p->g4Parent); eq_it != m_equivalentTracks.end() )   {
-        parent_id = (*eq_it).second;
-        in_map    = (j=m_particleMap.find(parent_id)) != m_particleMap.end();
+      if( int equiv = equivalent(p->g4Parent); equiv >= 0 )   {
+        parent_id = equiv;
+        in_map    = particle(parent_id) != nullptr;
         in_parent_list = p->parents.find(parent_id) != p->parents.end();
       }
       if ( !in_map || !in_parent_list )  {
@@ -789,9 +822,8 @@ void Geant4ParticleHandler::checkConsistency()  const   {
 }
 
 void Geant4ParticleHandler::setVertexEndpointBit() {
-  for( auto& part : m_particleMap )   {
-    auto* p = part.second;
-    if( !p->parents.empty() ) {
+  for( auto* p : m_particles )   {
+    if( p && !p->parents.empty() ) {
       PropertyMask mask(p->status);
       //if the particle did not go to geant4 none of these flags is set
       // we shouldn't set the vertex bit in this case.
@@ -803,7 +835,8 @@ void Geant4ParticleHandler::setVertexEndpointBit() {
                          |G4PARTICLE_SIM_STOPPED)) {
         continue;
       }
-      Geant4Particle *parent(m_particleMap[ *p->parents.begin() ]);
+      Geant4Particle *parent = particle(*p->parents.begin());
+      if( !parent ) continue;
       const double X( parent->vex - p->vsx );
       const double Y( parent->vey - p->vsy );
       const double Z( parent->vez - p->vsz );
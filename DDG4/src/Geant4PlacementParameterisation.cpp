@@ -22,7 +22,13 @@
 
 /// Initializing constructor
 dd4hep::sim::Geant4PlacementParameterisation::Geant4PlacementParameterisation(PlacedVolume pv)
-  : G4VPVParameterisation(), m_placement(pv), m_params(*pv.data()->params)
+  : Geant4PlacementParameterisation(pv, *pv.data()->params)
+{
+}
+
+/// Initializing constructor with parameters not attached to the placement
+dd4hep::sim::Geant4PlacementParameterisation::Geant4PlacementParameterisation(PlacedVolume pv, const Parameters& params)
+  : G4VPVParameterisation(), m_placement(pv), m_params(params)
 {
   G4Transform3D tr;
   auto& dim = m_dimensions;
@@ -91,23 +97,21 @@ void dd4hep::sim::Geant4PlacementParameterisation::ComputeTransformation(const G
   const auto& dim = m_dimensions;
   std::size_t nd  = dim.size();
   if ( !m_have_rotation )    {
+    // Copy numbers are ordered like the placements: the first dimension runs fastest
     G4ThreeVector tra = m_start.translation;
+    std::size_t   idx = copy;
     if ( nd >= 1 )   {
-      std::size_t d1 = 0;
-      if (nd == 1) d1 = copy;
-      else if (nd >= 2) d1 = copy%dim[1].count;
+      std::size_t d1 = nd == 1 ? idx : idx % dim[0].count;
       tra = tra + (dim[0].translation * d1);
+      idx = nd == 1 ? 0 : idx / dim[0].count;
     }
     if ( nd >= 2 )   {
-      std::size_t d2 = 0;
-      if (nd == 2) d2 = copy / dim[0].count;
-      else if (nd >= 3 ) d2 = copy%dim[2].count / dim[0].count;
+      std::size_t d2 = nd == 2 ? idx : idx % dim[1].count;
       tra = tra + (dim[1].translation * d2);
+      idx = nd == 2 ? 0 : idx / dim[1].count;
     }
     if ( nd >= 3 )   {
-      std::size_t d3 = 0;
-      if ( nd == 3 ) d3 = copy / (dim[0].count*dim[1].count);
-      tra = tra + (dim[2].translation * d3);
+      tra = tra + (dim[2].translation * idx);
     }
     pv->SetTranslation(tra);
     return;
@@ -15,6 +15,7 @@
 #include <DD4hep/Printout.h>
 #include <DD4hep/InstanceCount.h>
 #include <DDG4/Geant4Random.h>
+#include <DDG4/Geant4Context.h>
 
 #include <CLHEP/Random/EngineFactory.h>
 #include <CLHEP/Random/RandGamma.h>
@@ -23,6 +24,10 @@
 // ROOT include files
 #include <TRandom1.h>
 
+// Geant4 include files
+#include <G4Run.hh>
+#include <G4Event.hh>
+
 // C/C++ include files
 #include <cmath>
 
@@ -80,7 +85,7 @@ namespace    {
 
 /// Default constructor
 Geant4Random::Geant4Random(Geant4Context* ctxt, const std::string& nam)
-  : Geant4Action(ctxt,nam), m_engine(0), m_rootRandom(0), m_rootOLD(0), 
+  : Geant4Action(ctxt,nam), m_streamSeed(0), m_engine(0), m_rootRandom(0), m_rootOLD(0), 
     m_inited(false)
 {
   declareProperty("File",   m_file="");
@@ -188,6 +193,7 @@ void Geant4Random::initialize()   {
     }
   }
   m_engine->setSeed(m_seed,m_luxury);
+  m_streamSeed = m_seed;
   m_rootRandom = new RNDM(this);
   m_inited = true;
   if ( 0 == s_instance )   {
@@ -341,3 +347,17 @@ double Geant4Random::gamma(double k, double lambda)    {
   if ( !m_inited ) initialize();
   return CLHEP::RandGamma::shoot(this->m_engine, k, lambda);
 }
+
+/// Random stream of a named client for a given run and event
+dd4hep::CounterRandomStream
+Geant4Random::stream(unsigned int run, unsigned int event, const std::string& nam, unsigned int index)  const  {
+  return CounterRandomStream(uint64_t(m_inited ? m_streamSeed : m_seed), run, event, nam, index);
+}
+
+/// Random stream of an action for the run and event of its context
+dd4hep::CounterRandomStream Geant4Random::stream(const Geant4Action* action, unsigned int index)  const  {
+  Geant4Context* ctxt = action->context();
+  unsigned int run    = ctxt->runPtr()   ? ctxt->runPtr()->run().GetRunID()       : 0;
+  unsigned int event  = ctxt->eventPtr() ? ctxt->eventPtr()->event().GetEventID() : 0;
+  return stream(run, event, action->name(), index);
+}
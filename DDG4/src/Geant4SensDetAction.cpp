@@ -19,16 +19,21 @@
 #include <DDG4/Geant4Kernel.h>
 #include <DDG4/Geant4Mapping.h>
 #include <DDG4/Geant4StepHandler.h>
+#include <DDG4/Geant4StepContext.h>
 #include <DDG4/Geant4SensDetAction.h>
+#include <DDG4/Geant4FastSimSpot.h>
 #include <DDG4/Geant4VolumeManager.h>
 #include <DDG4/Geant4MonteCarloTruth.h>
 
 // Geant4 include files
 #include <G4Step.hh>
+#include <G4Track.hh>
 #include <G4SDManager.hh>
 #include <G4VSensitiveDetector.hh>
 
 // C/C++ include files
+#include <algorithm>
+#include <cstdint>
 #include <stdexcept>
 
 #include "G4OpticalParameters.hh"
@@ -138,6 +143,11 @@ bool Geant4Filter::operator()(const Geant4FastSimSpot*) const {
   return false;
 }
 
+/// Describe the filter as a term of a fused filter chain. Default: GENERIC
+Geant4Filter::Term Geant4Filter::term() const {
+  return Term();
+}
+
 /// Constructor. The detector element is identified by the name
 Geant4Sensitive::Geant4Sensitive(Geant4Context* ctxt, const std::string& nam, DetElement det, Detector& det_ref)
   : Geant4Action(ctxt, nam), m_detDesc(det_ref), m_detector(det)
@@ -149,6 +159,10 @@ Geant4Sensitive::Geant4Sensitive(Geant4Context* ctxt, const std::string& nam, De
   declareProperty("UseVolumeManager", m_useVolumeManager = true);
   declareProperty("HitCreationMode",  m_hitCreationMode = SIMPLE_MODE);
   declareProperty("DebugVolumeID",    m_debugVolumeID = false);
+  declareProperty("UseVolumeCache",   m_useVolumeCache = false);
+  declareProperty("ExpectedHits",     m_expectedHits = 0);
+  declareProperty("TruthMode",        m_truthMode = TRUTH_ALL);
+  declareProperty("TruthMaxContributions", m_truthMaxContributions = 10);
   m_sequence     = context()->kernel().sensitiveAction(m_detector.name());
   m_sensitive    = m_detDesc.sensitiveDetector(det.name());
   m_readout      = m_sensitive.readout();
@@ -157,6 +171,11 @@ Geant4Sensitive::Geant4Sensitive(Geant4Context* ctxt, const std::string& nam, De
 
 /// Standard destructor
 Geant4Sensitive::~Geant4Sensitive() {
+  if( m_volumeCache.lookups > 0 )  {
+    info("+++ Volume ID cache: %lu lookups, %lu hits [%.1f %%]",
+         m_volumeCache.lookups, m_volumeCache.hits,
+         100e0*double(m_volumeCache.hits)/double(m_volumeCache.lookups));
+  }
   m_filters(&Geant4Filter::release);
   m_filters.clear();
   InstanceCount::decrement(this);
@@ -259,6 +278,7 @@ void Geant4Sensitive::defineCollections() {
 
 /// Method invoked at the beginning of each event.
 void Geant4Sensitive::begin(G4HCofThisEvent* /* HCE */) {
+  m_truthIndex.reset();
 }
 
 /// Method invoked at the end of each event.
@@ -292,13 +312,138 @@ void Geant4Sensitive::mark(const G4Step* step) const  {
   if ( truth ) truth->mark(step);
 }
 
+/// Resolve the volume ID of a touchable using the last-volume cache if enabled
+VolumeID Geant4Sensitive::touchableVolumeID(const G4VTouchable* touchable)  {
+  const int depth = touchable && m_useVolumeCache ? touchable->GetHistoryDepth() : 0;
+  if( depth <= 0 )  {
+    Geant4VolumeManager volMgr = Geant4Mapping::instance().volumeManager();
+    return volMgr.volumeID(touchable);
+  }
+  /// Same history depth, physical volumes and copy numbers: same volume ID.
+  /// The leaf is compared first: volume changes are detected with the first comparison.
+  auto& cache = m_volumeCache;
+  bool  hit   = std::size_t(depth) == cache.volumes.size();
+  ++cache.lookups;
+  for( int j = 0; hit && j < depth; ++j )  {
+    hit = cache.volumes[j] == touchable->GetVolume(j) && cache.copies[j] == touchable->GetReplicaNumber(j);
+  }
+  if( hit )  {
+    ++cache.hits;
+    return cache.volumeID;
+  }
+  Geant4VolumeManager volMgr = Geant4Mapping::instance().volumeManager();
+  cache.volumeID = volMgr.volumeID(touchable);
+  cache.volumes.resize(depth);
+  cache.copies.resize(depth);
+  for( int j = 0; j < depth; ++j )  {
+    cache.volumes[j] = touchable->GetVolume(j);
+    cache.copies[j]  = touchable->GetReplicaNumber(j);
+  }
+  return cache.volumeID;
+}
+
+namespace  {
+  /// Merge a contribution into an existing one: deposits and lengths summed, energy weighted position
+  void merge_contribution(Geant4HitData::Contribution& c, const Geant4HitData::Contribution& add)  {
+    double sum = c.deposit + add.deposit;
+    if( sum > 0e0 )  {
+      double w1 = c.deposit / sum, w2 = add.deposit / sum;
+      c.setPosition(w1*c.x + w2*add.x, w1*c.y + w2*add.y, w1*c.z + w2*add.z);
+    }
+    c.deposit = sum;
+    c.length += add.length;
+  }
+}
+
+/// Add a Monte Carlo contribution to the truth record of a hit according to the truth mode
+void Geant4Sensitive::addContribution(const void* hit,
+                                      Geant4HitData::Contributions& truth,
+                                      const Geant4HitData::Contribution& contrib)
+{
+  switch( m_truthMode )  {
+  case TRUTH_MERGE_TRACKS:
+  case TRUTH_TOP_N:  {
+    /// Fast path: consecutive steps of the same track
+    if( !truth.empty() && truth.back().trackID == contrib.trackID )  {
+      merge_contribution(truth.back(), contrib);
+      truth.back().time = std::min(truth.back().time, contrib.time);
+      return;
+    }
+    /// The index entry may be stale or belong to another (hit,track) pair: always verify
+    uint64_t hit_key = uint64_t(reinterpret_cast<uintptr_t>(hit)) * 0x9E3779B97F4A7C15ULL;
+    std::size_t& idx = m_truthIndex[hit_key ^ uint32_t(contrib.trackID)];
+    if( idx >= truth.size() || truth[idx].trackID != contrib.trackID )  {
+      idx = truth.size();
+      for( std::size_t i = 0; i < truth.size(); ++i )  {
+        if( truth[i].trackID == contrib.trackID )  {
+          idx = i;
+          break;
+        }
+      }
+    }
+    if( idx < truth.size() )  {
+      merge_contribution(truth[idx], contrib);
+      truth[idx].time = std::min(truth[idx].time, contrib.time);
+      return;
+    }
+    truth.emplace_back(contrib);
+    if( m_truthMode == TRUTH_TOP_N && m_truthMaxContributions > 0 )  {
+      /// The summed contributions of the dropped tracks are the first entry. The index
+      /// holds the track identifier it is attributed to. Verify it like the track entries
+      std::size_t& other = m_truthIndex[hit_key ^ 0xFFFFFFFFULL];
+      /// Hit memory is recycled: the entry may be left from a previous hit at this address
+      if( truth.size() == 1 )  {
+        other = 0;
+      }
+      std::size_t  first = (other != 0 && truth.front().trackID == int(other)) ? 1 : 0;
+      if( truth.size() - first > std::size_t(m_truthMaxContributions) )  {
+        /// Move the track contribution with the smallest deposit to the summed entry
+        auto smallest = std::min_element(truth.begin() + first, truth.end(),
+                                         [](const Geant4HitData::Contribution& a, const Geant4HitData::Contribution& b)
+                                         {  return a.deposit < b.deposit;  });
+        if( first == 0 )  {
+          std::swap(truth.front(), *smallest);
+          other = truth.front().trackID;
+          return;
+        }
+        merge_contribution(truth.front(), *smallest);
+        truth.front().time = std::min(truth.front().time, smallest->time);
+        if( smallest != truth.end()-1 )  {
+          *smallest = std::move(truth.back());
+        }
+        truth.pop_back();
+      }
+    }
+    return;
+  }
+  case TRUTH_AGGREGATE:
+    if( !truth.empty() )  {
+      auto& c = truth.front();
+      double sum = c.deposit + contrib.deposit;
+      if( sum > 0e0 )  {
+        c.time = (c.deposit*c.time + contrib.deposit*contrib.time) / sum;
+      }
+      merge_contribution(c, contrib);
+      return;
+    }
+    truth.emplace_back(contrib);
+    return;
+  case TRUTH_ALL:
+  default:
+    truth.emplace_back(contrib);
+    return;
+  }
+}
+
 /// Returns the volumeID of the sensitive volume corresponding to the step
 long long int Geant4Sensitive::volumeID(const G4Step* step) {
   VolumeID volID = m_detector.id();
   if( this->useVolumeManager() )  {
-    Geant4StepHandler   stepH(step);
-    Geant4VolumeManager volMgr = Geant4Mapping::instance().volumeManager();
-    volID = volMgr.volumeID(stepH.preTouchable());
+    Geant4StepContext& ctxt = Geant4StepContext::get(step);
+    if( !ctxt.volumeID(volID) )  {
+      volID = touchableVolumeID(step->GetPreStepPoint()->GetTouchable());
+      ctxt.setVolumeID(volID);
+    }
     if( this->m_debugVolumeID )  {
       _print_volumeid(this, "Volume ID", volID, step->GetTotalEnergyDeposit());
     }
@@ -310,8 +455,7 @@ long long int Geant4Sensitive::volumeID(const G4Step* step) {
 long long int Geant4Sensitive::volumeID(const G4VTouchable* touchable) {
   VolumeID volID = m_detector.id();
   if( this->useVolumeManager() )  {
-    Geant4VolumeManager volMgr = Geant4Mapping::instance().volumeManager();
-    volID= volMgr.volumeID(touchable);
+    volID = touchableVolumeID(touchable);
     if( this->m_debugVolumeID )  {
       _print_volumeid(this, "Volume ID", volID);
     }
@@ -324,21 +468,36 @@ long long int Geant4Sensitive::cellID(const G4Step* step)  {
   VolumeID volID = m_detector.id();
   if( this->useVolumeManager() )  {
     Geant4StepHandler h(step);
-    Geant4VolumeManager volMgr = Geant4Mapping::instance().volumeManager();
     bool UsePostStepOnly = G4OpticalParameters::Instance() &&
       G4OpticalParameters::Instance()->GetBoundaryInvokeSD() &&
       (step->GetTrack()->GetDefinition() == G4OpticalPhoton::Definition());
 
-    volID = volMgr.volumeID(UsePostStepOnly? h.postTouchable() : h.preTouchable());
+    /// The step context caches the identifiers of the pre-step touchable for all sensitive actions
+    Geant4StepContext* ctxt = UsePostStepOnly ? nullptr : &Geant4StepContext::get(step);
+    const void*        segm = m_segmentation.ptr();
+    if( ctxt && m_segmentation.isValid() && ctxt->cellID(segm, volID) )  {
+      if( this->m_debugVolumeID )  {
+        _print_volumeid(this, "Cell ID", volID, step->GetTotalEnergyDeposit());
+      }
+      return volID;
+    }
+    if( UsePostStepOnly )  {
+      volID = touchableVolumeID(h.postTouchable());
+    }
+    else if( !ctxt->volumeID(volID) )  {
+      volID = touchableVolumeID(h.preTouchable());
+      ctxt->setVolumeID(volID);
+    }
     if ( m_segmentation.isValid() )  {
       std::exception_ptr eptr;
-      G4ThreeVector global = UsePostStepOnly? h.postPosG4() : 0.5 * (h.prePosG4()+h.postPosG4());
+      G4ThreeVector global = UsePostStepOnly? h.postPosG4() : ctxt->midpointG4();
       G4ThreeVector local  = UsePostStepOnly? h.postTouchable()->GetHistory()->GetTopTransform().TransformPoint(global) :
         h.preTouchable()->GetHistory()->GetTopTransform().TransformPoint(global);
       Position loc(local.x()*MM_2_CM, local.y()*MM_2_CM, local.z()*MM_2_CM);
       Position glob(global.x()*MM_2_CM, global.y()*MM_2_CM, global.z()*MM_2_CM);
       try  {
         VolumeID cID = m_segmentation.cellID(loc, glob, volID);
+        if( ctxt ) ctxt->setCellID(segm, cID);
         if( this->m_debugVolumeID )  {
           _print_volumeid(this, "Cell ID", cID, step->GetTotalEnergyDeposit());
         }
@@ -368,9 +527,7 @@ long long int Geant4Sensitive::cellID(const G4Step* step)  {
 long long int Geant4Sensitive::cellID(const G4VTouchable* touchable, const G4ThreeVector& global) {
   VolumeID volID = m_detector.id();
   if( this->useVolumeManager() )  {
-    Geant4VolumeManager volMgr = Geant4Mapping::instance().volumeManager();
-
-    volID = volMgr.volumeID(touchable);
+    volID = touchableVolumeID(touchable);
     if ( m_segmentation.isValid() )  {
       std::exception_ptr eptr;
       G4ThreeVector local  = touchable->GetHistory()->GetTopTransform().TransformPoint(global);
@@ -414,6 +571,7 @@ Geant4SensDetActionSequence::Geant4SensDetActionSequence(Geant4Context* ctxt, co
   m_sensitive = context()->detectorDescription().sensitiveDetector(nam);
   m_sensitiveType = m_sensitive.type();
   declareProperty("SensitiveType", m_sensitiveType);
+  declareProperty("FuseFilters",   m_fuseFilters);
   InstanceCount::increment(this);
 }
 
@@ -454,11 +612,57 @@ void Geant4SensDetActionSequence::adopt(Geant4Filter* filter) {
   if (filter) {
     filter->addRef();
     m_filters.add(filter);
+    m_filterChain.valid = false;
     return;
   }
   except("Attempt to add invalid sensitive filter!");
 }
 
+/// Build the fused filter chain from the filter objects
+void Geant4SensDetActionSequence::buildFilterChain()   {
+  FilterChain chain;
+  for (const Geant4Filter* filter : m_filters)  {
+    Geant4Filter::Term t = filter->term();
+    switch(t.type)  {
+    case Geant4Filter::Term::ENERGY_CUT:
+      chain.cut = chain.haveCut ? std::max(chain.cut, t.cut) : t.cut;
+      chain.haveCut = true;
+      break;
+    case Geant4Filter::Term::REJECT_PARTICLE:
+      for (const G4ParticleDefinition* def : t.particles)
+        if ( def ) chain.reject.emplace_back(def);
+      break;
+    case Geant4Filter::Term::SELECT_PARTICLE:
+      for (const G4ParticleDefinition* def : t.particles)
+        if ( def ) chain.select.emplace_back(def);
+      break;
+    default:
+      chain.generic.emplace_back(filter);
+      break;
+    }
+  }
+  chain.valid = true;
+  m_filterChain = std::move(chain);
+  printout(DEBUG, name(), "+++ Filter chain: cut:%s %g reject:%ld select:%ld generic:%ld filters",
+           m_filterChain.haveCut ? "YES" : "NO", m_filterChain.cut,
+           long(m_filterChain.reject.size()), long(m_filterChain.select.size()),
+           long(m_filterChain.generic.size()));
+}
+
+/// Evaluate the chain on the step summary
+template <typename T> bool
+Geant4SensDetActionSequence::FilterChain::operator()(const T* step, double edep, const G4ParticleDefinition* def)  const  {
+  if ( haveCut && !(edep > cut) )
+    return false;
+  for (const G4ParticleDefinition* d : reject)
+    if ( d == def ) return false;
+  for (const G4ParticleDefinition* d : select)
+    if ( d != def ) return false;
+  for (const Geant4Filter* filter : generic)
+    if ( !(*filter)(step) ) return false;
+  return true;
+}
+
 /// Initialize the usage of a hit collection. Returns the collection identifier
 std::size_t Geant4SensDetActionSequence::defineCollection(Geant4Sensitive* owner, const std::string& collection_name, create_t func) {
   m_collections.emplace_back(collection_name, make_pair(owner,func));
@@ -512,6 +716,10 @@ Geant4HitCollection* Geant4SensDetActionSequence::collectionByID(std::size_t id)
 
 /// Callback before hit processing starts. Invoke all filters.
 bool Geant4SensDetActionSequence::accept(const G4Step* step) const {
+  if ( m_filterChain.valid )  {
+    const G4Track* track = step->GetTrack();
+    return m_filterChain(step, step->GetTotalEnergyDeposit(), track ? track->GetDefinition() : nullptr);
+  }
   bool (Geant4Filter::*filter)(const G4Step*) const = &Geant4Filter::operator();
   bool result = m_filters.filter(filter, step);
   return result;
@@ -519,6 +727,10 @@ bool Geant4SensDetActionSequence::accept(const G4Step* step) const {
 
 /// Callback before hit processing starts. Invoke all filters.
 bool Geant4SensDetActionSequence::accept(const Geant4FastSimSpot* spot) const {
+  if ( m_filterChain.valid )  {
+    const G4Track* track = spot->primary;
+    return m_filterChain(spot, spot->energy(), track ? track->GetDefinition() : nullptr);
+  }
   bool (Geant4Filter::*filter)(const Geant4FastSimSpot*) const = &Geant4Filter::operator();
   bool result = m_filters.filter(filter, spot);
   return result;
@@ -527,7 +739,9 @@ bool Geant4SensDetActionSequence::accept(const Geant4FastSimSpot* spot) const {
 /// G4VSensitiveDetector interface: Method for generating hit(s) using the information of G4Step object.
 bool Geant4SensDetActionSequence::process(const G4Step* step, G4TouchableHistory* history) {
   bool result = false;
+  Geant4StepContext::get(step);
   for (Geant4Sensitive* sensitive : m_actors)  {
+    Geant4ActionProfiler::Timer timer(sensitive);
     if ( sensitive->accept(step) )
       result |= sensitive->process(step, history);
   }
@@ -552,6 +766,9 @@ bool Geant4SensDetActionSequence::processFastSim(const Geant4FastSimSpot* spot,
  */
 void Geant4SensDetActionSequence::begin(G4HCofThisEvent* hce) {
   m_hce = hce;
+  if ( m_fuseFilters && !m_filterChain.valid )  {
+    buildFilterChain();
+  }
   for (std::size_t count = 0; count < m_collections.size(); ++count) {
     const HitCollection& cr = m_collections[count];
     Geant4HitCollection* col = (*cr.second.second)(name(), cr.first, cr.second.first);
@@ -250,9 +250,8 @@ namespace dd4hep {
       return new G4GenericTrap(sh->GetName(), sh->GetDz() * CM_2_MM, vertices);
     }
 
-    template <> G4VSolid* convertShape<TGeoTessellated>(const TGeoShape* shape)  {
-      TGeoTessellated*   sh  = (TGeoTessellated*) shape;
-      G4TessellatedSolid* g4 = new G4TessellatedSolid(sh->GetName());
+    /// Add the facets of a tessellated shape to an empty Geant4 tessellated solid and close it
+    void fillTessellatedSolid(const TGeoTessellated* sh, G4TessellatedSolid* g4)  {
       int num_facet = sh->GetNfacets();
 
       printout(DEBUG,"TessellatedSolid","+++ %s> Converting %d facets", sh->GetName(), num_facet);
@@ -294,6 +293,12 @@ namespace dd4hep {
         g4->AddFacet(g4f);
       }
       g4->SetSolidClosed(sh->IsClosedBody());
+    }
+
+    template <> G4VSolid* convertShape<TGeoTessellated>(const TGeoShape* shape)  {
+      TGeoTessellated*   sh  = (TGeoTessellated*) shape;
+      G4TessellatedSolid* g4 = new G4TessellatedSolid(sh->GetName());
+      fillTessellatedSolid(sh, g4);
       return g4;
     }
     
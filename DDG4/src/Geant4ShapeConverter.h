@@ -19,7 +19,9 @@
 
 // Forward declarations
 class TGeoShape;
+class TGeoTessellated;
 class G4VSolid;
+class G4TessellatedSolid;
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -30,6 +32,10 @@ namespace dd4hep {
     /// Convert a specific TGeo shape into the geant4 equivalent
     template <typename T> G4VSolid* convertShape(const TGeoShape* shape);
 
+    /// Add the facets of a tessellated shape to an empty Geant4 tessellated solid and close it
+    /** Only accesses the solid itself: distinct solids may be filled in parallel. */
+    void fillTessellatedSolid(const TGeoTessellated* shape, G4TessellatedSolid* solid);
+
   }    // End namespace sim
 }      // End namespace dd4hep
 #endif // DDG4_SRC_GEANT4SHAPECONVERTER_H
@@ -162,7 +162,11 @@ TrackClassification
 Geant4StackingActionSequence::classifyNewTrack(G4StackManager* stackManager,
                                                const G4Track* track)   {
   for( auto a : m_actors )   {
-    auto ret = a->classifyNewTrack(stackManager, track);
+    TrackClassification ret;
+    {
+      Geant4ActionProfiler::Timer timer(a);
+      ret = a->classifyNewTrack(stackManager, track);
+    }
     if ( ret.type != NoTrackClassification )  {
       return ret;
     }
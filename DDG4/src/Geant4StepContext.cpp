@@ -0,0 +1,50 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+
+// Framework include files
+#include <DDG4/Geant4StepContext.h>
+#include <DDG4/Geant4SensDetAction.h>
+
+// Geant4 include files
+#include <G4StepPoint.hh>
+#include <G4VSensitiveDetector.hh>
+
+using namespace dd4hep::sim;
+
+/// Access the context of the current thread
+Geant4StepContext& Geant4StepContext::instance()   {
+  static thread_local Geant4StepContext s_context;
+  return s_context;
+}
+
+/// Compute the midpoint and the chord length
+void Geant4StepContext::computeMidpoint()   {
+  const G4ThreeVector& pre  = m_step->GetPreStepPoint()->GetPosition();
+  const G4ThreeVector& post = m_step->GetPostStepPoint()->GetPosition();
+  m_midpointG4 = 0.5 * (pre + post);
+  m_length     = (post - pre).mag();
+  m_valid     |= MIDPOINT;
+}
+
+/// Sensitive type flags of a sensitive detector (see SensitiveType)
+int Geant4StepContext::sensitiveType(const G4VSensitiveDetector* sd)   {
+  if ( sd != m_typeSD )  {
+    const Geant4ActionSD* action_sd = dynamic_cast<const Geant4ActionSD*>(sd);
+    m_typeSD      = sd;
+    m_typeSDFlags = SD_NONE;
+    if ( action_sd )  {
+      // Assume by default "tracker"
+      m_typeSDFlags = action_sd->sensitiveType() == "calorimeter" ? SD_CALORIMETER : SD_TRACKER;
+    }
+  }
+  return m_typeSDFlags;
+}
@@ -14,6 +14,7 @@
 // Framework include files
 #include <DD4hep/InstanceCount.h>
 #include <DDG4/Geant4SteppingAction.h>
+#include <DDG4/Geant4StepContext.h>
 
 // Geant4 headers
 #include <G4Threading.hh>
@@ -111,8 +112,11 @@ Geant4SteppingAction* Geant4SteppingActionSequence::get(const std::string& nam)
 
 /// Pre-track action callback
 void Geant4SteppingActionSequence::operator()(const G4Step* step, G4SteppingManager* mgr) {
+  Geant4StepContext& ctxt = Geant4StepContext::get(step);
   m_actors(&Geant4SteppingAction::operator(), step, mgr);
   m_calls(step, mgr);
+  // The sensitive detectors and all stepping actions are done with this step
+  ctxt.reset();
 }
 
 /// Add an actor responding to all callbacks. Sequence takes ownership.
@@ -183,6 +183,7 @@ namespace  {
       PrintLevel   print_res       = (m_debug&Geant4VolumeManager::PRINT_RESULT) ? ALWAYS : m_geo.printLevel;
       bool         print_nodes     = (m_debug&Geant4VolumeManager::PRINT_NODES)  ? true : false;
       Geant4TouchableHandler::Geant4PlacementPath path;
+      std::vector<Geant4GeometryInfo::CopyField> copy_fields;
       Registries::const_iterator i = m_entries.find(code);
 
       printout(print_action,"Geant4VolumeManager","+++ Add path:%s vid:%016X",
@@ -195,11 +196,11 @@ namespace  {
           auto g4pit = m_geo.g4Placements.find(node);
           if( g4pit != m_geo.g4Placements.end() )  {
             G4VPhysicalVolume* phys = g4pit->second;
-            if( phys->IsParameterised() )  {
-              PlacedVolume pv(n);
-              PlacedVolumeExtension* ext = pv.data();
-              if( nullptr == ext->params->field )  {
-                ext->params->field = iddesc.field(ext->volIDs.at(0).first);
+            if( phys->IsParameterised() || phys->IsReplicated() )  {
+              const PlacedVolumeExtension* ext = PlacedVolume(node).data();
+              /// Parameterised placements without volume ID do not contribute to the volume ID
+              if( ext && !ext->volIDs.empty() )  {
+                copy_fields.push_back({ int(path.size()), iddesc.field(ext->volIDs.at(0).first) });
               }
             }
             path.emplace_back(phys);
@@ -214,6 +215,12 @@ namespace  {
             for(const auto& imp : iVolImp->second )  {
               const auto& c = imp.first;
               if ( c.size() <= control.size() && control == c )  {
+                if( imp.second->IsParameterised() || imp.second->IsReplicated() )  {
+                  /// No volume ID field is known for the copy number of imprints
+                  except("Geant4VolumeManager",
+                         "+++ Parameterised or replicated imprint %s of %s: volume IDs cannot be encoded.",
+                         imp.second->GetName().c_str(), detail::tools::placementPath(nodes, false).c_str());
+                }
                 path.emplace_back(imp.second);
                 printout(print_chain, "Geant4VolumeManager", "+++     Chain: Node OK: %s %s -> %s",
                          node->GetName(), detail::tools::placementPath(c,false).c_str(),
@@ -231,7 +238,13 @@ namespace  {
           printout(print_res, "Geant4VolumeManager", "+++     Map %016X to Geant4 Path:%s",
                    (void*)code, Geant4TouchableHandler::placementPath(path).c_str());
           auto hash = detail::hash64(&path[0], path.size()*sizeof(path[0]));
-          bool missing_hash_path = m_geo.g4Paths.find(hash) == m_geo.g4Paths.end();
+          bool missing_hash_path = m_geo.g4Paths.find(hash) == nullptr;
+          /// Any placement of the path may be parametrised or replicated, not only the leaf
+          Geant4GeometryInfo::PlacementFlags opt;
+          for( const G4VPhysicalVolume* phys : path )  {
+            if( phys->IsParameterised() ) opt.flags.parametrised = 1;
+            if( phys->IsReplicated() )    opt.flags.replicated   = 1;
+          }
 #ifdef VOLMGR_HAVE_DEBUG_INFO
           {
             bool missing_real_path = m_geo.g4DebugInfo->g4Paths.find(path) == m_geo.g4DebugInfo->g4Paths.end();
@@ -243,18 +256,21 @@ namespace  {
               printout(ERROR,"Geant4VolumeManager",  " Offend.VolIDs: %s", detail::tools::toString(iddesc,ids,code).c_str());
             }
             if ( missing_real_path ) {
-              Geant4GeometryInfo::PlacementFlags opt;
-              opt.flags.parametrised = path.front()->IsParameterised() ? 1 : 0;
-              opt.flags.replicated   = path.front()->IsReplicated()    ? 1 : 0;
               m_geo.g4DebugInfo->g4Paths[path] = { code, opt.value };
             }
           }
 #endif
           if ( missing_hash_path ) {
-            Geant4GeometryInfo::PlacementFlags opt;
-            opt.flags.parametrised = path.front()->IsParameterised() ? 1 : 0;
-            opt.flags.replicated   = path.front()->IsReplicated()    ? 1 : 0;
-            m_geo.g4Paths[hash]    = { code, opt.value };
+            auto& entry = m_geo.g4Paths[hash];
+            entry = { code, opt.value, 0 };
+            if( opt.value != 0 )  {
+              /// Precompute the depths and fields of the copy numbers to be added to the volume ID
+              entry.copyFields = uint32_t(m_geo.g4CopyFields.size());
+              for( const auto& f : copy_fields )  {
+                if( f.depth < int(path.size()) ) m_geo.g4CopyFields.push_back(f);
+              }
+              m_geo.g4CopyFields.push_back({ -1, nullptr });
+            }
             if( m_debug&Geant4VolumeManager::PRINT_VOLIDS )  {
               std::string idstr = iddesc.str(code);
               printout(ALWAYS, "Geant4VolumeManager",
@@ -264,7 +280,7 @@ namespace  {
             return;
           }
           /// This is a normal case for parametrized volumes and no error
-          if ( !path.empty() && (path.front()->IsParameterised() || path.front()->IsReplicated()) )  {
+          if ( opt.value != 0 )  {
             return;
           }
           printout(ERROR, "Geant4VolumeManager", "populate: Severe error: Duplicated Geant4 path!!!! %s %s",
@@ -317,14 +333,17 @@ Geant4VolumeManager::Geant4VolumeManager(const Detector& description, Geant4Geom
       Populator p(description, *info, debug);
       printout( ALWAYS, "Geant4VolumeManager", "+++ Populating Geant4 volume manager.");
       p.populate(description.world());
+      /// From now on the path table is only read: it may be shared by all worker threads
+      info->g4Paths.freeze();
+      info->g4CopyFields.shrink_to_fit();
       printout( ALWAYS, "Geant4VolumeManager",
-                "+++ Geant4 volume manager populated with %ld sensitive path entries.",
-                info->g4Paths.size() );
+                "+++ Geant4 volume manager populated with %ld sensitive path entries [%ld kB].",
+                info->g4Paths.size(), info->g4Paths.memoryUsage()/1024 );
       if( debug&PRINT_ENTRIES )  {
         int count = 0;
         VolumeManager volmgr = description.volumeManager();
-        for( auto it=info->g4Paths.begin(); it != info->g4Paths.end(); ++it, ++count )  {
-          VolumeID volid = it->second.volumeID;
+        info->g4Paths.for_each([&count, &volmgr](uint64_t, const Geant4GeometryInfo::Placement& entry)  {
+          VolumeID volid = entry.volumeID;
           VolumeManagerContext* context = volmgr.lookupContext(volid);
           if( context )  {
             std::string  path = context->element.path();
@@ -339,7 +358,8 @@ Geant4VolumeManager::Geant4VolumeManager(const Detector& description, Geant4Geom
             printout( ERROR, "Geant4VolumeManager",
                       "Missing volume manager entry: volume ID %016X", volid);
           }
-        }
+          ++count;
+        });
       }
       info->has_volmgr = true;
     }
@@ -381,8 +401,12 @@ namespace  {
 
 /// Access CELLID by Geant4 touchable object
 VolumeID Geant4VolumeManager::volumeID(const G4VTouchable* touchable) const  {
-  Geant4TouchableHandler handler(touchable);
-  std::vector<const G4VPhysicalVolume*> path = handler.placementPath();
+  if( !touchable )  {
+    except("Geant4TouchableHandler", "Attempt to access invalid G4 touchable object.");
+  }
+  /// The path hash is computed while walking the touchable history:
+  /// Identical to hash64 of the placement path, but without heap allocation.
+  const int depth = touchable->GetHistoryDepth();
   if( !isValid() )  {
     printout(INFO, "Geant4VolumeManager", "+++   INVALID Geant4VolumeManager handle.");
     return NonExisting;
@@ -391,71 +415,50 @@ VolumeID Geant4VolumeManager::volumeID(const G4VTouchable* touchable) const  {
     printout(INFO, "Geant4VolumeManager", "+++   INVALID Geant4VolumeManager [Not initialized]");
     return NonExisting;
   }
-  else if( path.empty() )  {
+  else if( depth <= 0 )  {
     printout(INFO, "Geant4VolumeManager", "+++   EMPTY volume Geant4 Path: %s",
-             Geant4TouchableHandler::placementPath(path).c_str());
+             Geant4TouchableHandler::placementPath(placementPath(touchable)).c_str());
     return NonExisting;
   }
   else  {
-    uint64_t hash = detail::hash64(&path[0], sizeof(path[0])*path.size());
-    auto i = ptr()->g4Paths.find(hash);
-    if( i != ptr()->g4Paths.end() )  {
-      const auto& e = (*i).second;
-      VolumeID volid = e.volumeID;
+    const G4VPhysicalVolume* phys = touchable->GetVolume(0);
+    uint64_t hash = detail::hash64(&phys, sizeof(phys));
+    for( int j=1; j < depth; ++j )  {
+      phys = touchable->GetVolume(j);
+      hash = detail::update_hash64(hash, &phys, sizeof(phys));
+    }
+    const auto* e = ptr()->g4Paths.find(hash);
+    if( e )  {
+      VolumeID volid = e->volumeID;
       /// No parametrization or replication.
-      if( e.flags == 0 )  {
+      if( e->flags == 0 )  {
         return volid;
       }
-      const auto& paramterised = ptr()->g4Parameterised;
-      const auto& replicated   = ptr()->g4Replicated;
-      /// This is incredibly slow .... but what can I do ? Need a better idea.
-      for( std::size_t j=0; j < path.size(); ++j )  {
-        const auto* phys = path[j];
-        if( phys->IsParameterised() )  {
-          int copy_no = touchable->GetCopyNumber(j);
-          const auto it = paramterised.find(phys);
-          if( it != paramterised.end() )  {
-            //printout(INFO,"Geant4VolumeManager",
-            //         "Copy number:   %ld  <--> %ld", copy_no, long(phys->GetCopyNo()));
-            const auto* field = (*it).second.data()->params->field;
-            volid |= IDDescriptor::encode(field, copy_no);
-            continue;
-          }
-          except("Geant4VolumeManager",
-                 "Error  Geant4VolumeManager::volumeID(const G4VTouchable* touchable)");
-        }
-        else if( phys->IsReplicated() )   {
-          int copy_no = touchable->GetCopyNumber(j);
-          const auto it = replicated.find(phys);
-          if( it != replicated.end() )  {
-            const auto* field = (*it).second.data()->params->field;
-            volid |= IDDescriptor::encode(field, copy_no);
-            continue;
-          }
-          except("Geant4VolumeManager",
-                 "Error  Geant4VolumeManager::volumeID(const G4VTouchable* touchable)");
-        }
+      /// Parametrised or replicated: add the copy numbers at the depths precomputed by populate
+      for( const auto* f = &ptr()->g4CopyFields[e->copyFields]; f->depth >= 0; ++f )  {
+        volid |= IDDescriptor::encode(f->field, touchable->GetCopyNumber(f->depth));
       }
       return volid;
     }
-    if( !path[0] )  {
+    /// Diagnostics only: here the placement path may be allocated
+    const G4VPhysicalVolume* leaf = touchable->GetVolume(0);
+    if( !leaf )  {
       printout(INFO, "Geant4VolumeManager", "+++   Bad Geant4 volume path: \'%s\' [invalid path] %s",
-               Geant4TouchableHandler::placementPath(path).c_str(), debug_status(this).c_str());
+               Geant4TouchableHandler::placementPath(placementPath(touchable)).c_str(), debug_status(this).c_str());
       return InvalidPath;
     }
-    else if( !path[0]->GetLogicalVolume()->GetSensitiveDetector() )  {
-      printout(DEBUG, "Geant4VolumeManager", "+++   Bad Geant4 volume path: \'%s\' [insensitive] %s",
-               Geant4TouchableHandler::placementPath(path).c_str(), debug_status(this).c_str());
+    else if( !leaf->GetLogicalVolume()->GetSensitiveDetector() )  {
+      if( isActivePrintLevel(DEBUG) )  {
+        printout(DEBUG, "Geant4VolumeManager", "+++   Bad Geant4 volume path: \'%s\' [insensitive] %s",
+                 Geant4TouchableHandler::placementPath(placementPath(touchable)).c_str(), debug_status(this).c_str());
+      }
       return Insensitive;
     }
     printout(INFO, "Geant4VolumeManager",
              "+++   Bad Geant4 volume path: \'%s\' [missing entry] %s",
-             Geant4TouchableHandler::placementPath(path).c_str(), debug_status(this).c_str());
+             Geant4TouchableHandler::placementPath(placementPath(touchable)).c_str(), debug_status(this).c_str());
     return NonExisting;
   }
-  printout(INFO, "Geant4VolumeManager", "+++   Bad Geant4 volume path: \'%s\' %s",
-           Geant4TouchableHandler::placementPath(path).c_str(), yes_no(path.empty()));
-  return NonExisting;
 }
 
 /// Access fully decoded volume fields  by placement path
@@ -466,22 +469,18 @@ void Geant4VolumeManager::volumeDescriptor(const std::vector<const G4VPhysicalVo
   vol_desc.first = NonExisting;
   if( !path.empty() && checkValidity() )  {
     auto hash = detail::hash64(&path[0], sizeof(path[0])*path.size());
-    auto i = ptr()->g4Paths.find(hash);
-    if( i != ptr()->g4Paths.end() )  {
-      VolumeID vid = (*i).second.volumeID;
+    const auto* e = ptr()->g4Paths.find(hash);
+    if( e )  {
+      VolumeID vid = e->volumeID;
       G4LogicalVolume* lvol = path[0]->GetLogicalVolume();
       if( lvol->GetSensitiveDetector() ) {
-        const auto* node = path[0];
-        const auto& pm = ptr()->g4Placements;
-        for( const auto& ipm : pm )  {
-          if ( ipm.second == node )  {
-            PlacedVolume      pv  = ipm.first;
-            SensitiveDetector sd  = pv.volume().sensitiveDetector();
-            IDDescriptor      dsc = sd.readout().idSpec();
-            vol_desc.first = vid;
-            dsc.decodeFields(vid, vol_desc.second);
-            return;
-          }
+        PlacedVolume pv = ptr()->placement(path[0]);
+        if ( pv.isValid() )  {
+          SensitiveDetector sd  = pv.volume().sensitiveDetector();
+          IDDescriptor      dsc = sd.readout().idSpec();
+          vol_desc.first = vid;
+          dsc.decodeFields(vid, vol_desc.second);
+          return;
         }
       }
       vol_desc.first = Insensitive;
@@ -84,6 +84,9 @@ namespace dd4hep {
       /// Set a specific region to limit the scan (resets other selection criteria)
       void setRegion(Region region);
 
+      /// Access the currently selected placements (empty: no restrictions)
+      const std::set<const TGeoNode*>& selection()  const  {  return m_placements;  }
+
       /// Scan along a line and store the matrials internally
       const MaterialVec& scan(double x0, double y0, double z0, double x1, double y1, double z1, double epsilon=1e-4)  const;
 
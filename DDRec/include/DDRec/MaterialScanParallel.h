@@ -0,0 +1,142 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+#ifndef DDREC_MATERIALSCANPARALLEL_H
+#define DDREC_MATERIALSCANPARALLEL_H
+
+// Framework include files
+#include "DDRec/MaterialScan.h"
+
+/// C/C++ include files
+#include <string>
+#include <vector>
+#include <map>
+
+/// Forward declarations
+class TGeoNavigator;
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the reconstruction part of the AIDA detector description toolkit
+  namespace rec {
+
+    /// Multi-threaded material scan over many straight lines
+    /**
+     *  The rays are distributed over a configurable number of worker threads.
+     *  Each worker owns a private TGeoNavigator and accumulates the traversed
+     *  radiation and interaction lengths in private buffers, which are merged
+     *  once all workers finished.
+     *
+     *  The results are binned in two user defined coordinates (u,v), e.g. (eta,phi).
+     *  For each bin the mean number of X0 and lambda over all rays falling into the bin
+     *  is provided for the full path, per subdetector (first level daughter of the world)
+     *  and per material.
+     *
+     *  If a MaterialScan instance is supplied, its selection (region, subdetector or material)
+     *  restricts the accounted path segments in the same way as MaterialScan::print.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_REC
+     */
+    class MaterialScanParallel  {
+    public:
+      /// Definition of a single ray to be scanned
+      struct Ray  {
+        Vector3D start;
+        Vector3D end;
+        /// Bin coordinates of the ray
+        double   u  { 0e0 };
+        double   v  { 0e0 };
+      };
+      /// Two dimensional binning of the result
+      struct Binning  {
+        int    nu   { 1 };
+        double umin { 0e0 };
+        double umax { 1e0 };
+        int    nv   { 1 };
+        double vmin { 0e0 };
+        double vmax { 1e0 };
+        /// Number of bins
+        std::size_t size()  const  {  return std::size_t(nu) * std::size_t(nv); }
+        /// Linear bin index from coordinates. -1 if out of range
+        long index(double u, double v)  const;
+      };
+      /// Accumulated material budget of one category (total, subdetector or material)
+      /**  The bin vectors are empty if the category was not traversed by any ray. */
+      struct Budget  {
+        std::string         name;
+        /// Mean number of radiation lengths per bin
+        std::vector<double> x0;
+        /// Mean number of interaction lengths per bin
+        std::vector<double> lambda;
+      };
+
+    protected:
+      /// Reference to detector setup
+      Detector&                     m_detector;
+      /// Optional selection of placements to be accounted (empty: all)
+      std::set<const TGeoNode*>     m_selection;
+      /// Result binning
+      Binning                       m_binning;
+      /// Number of worker threads
+      int                           m_numThreads  { 1 };
+      /// Map first level daughters of the world to the subdetector index
+      std::map<const TGeoNode*, std::size_t> m_topNodes;
+      /// Number of rays per bin
+      std::vector<long>             m_entries;
+      /// Total material budget
+      Budget                        m_total;
+      /// Material budget per subdetector
+      std::vector<Budget>           m_detectors;
+      /// Material budget per material
+      std::vector<Budget>           m_materials;
+
+      /// Per-thread accumulation buffer
+      class Worker;
+      /// Scan a single ray with a given navigator and fill the worker buffers
+      void scanRay(TGeoNavigator* nav, const Ray& ray, double epsilon, Worker& worker)  const;
+
+    public:
+      /// Standard constructor. If scan is supplied, its selection criteria are used
+      MaterialScanParallel(Detector& description, const MaterialScan* scan = nullptr);
+      /// Default destructor
+      virtual ~MaterialScanParallel();
+
+      /// Set the number of worker threads (<=0: hardware concurrency)
+      void setNumThreads(int num_threads);
+      /// Access the number of worker threads
+      int numThreads()  const   {  return m_numThreads;  }
+      /// Set the binning of the results
+      void setBinning(const Binning& binning);
+      /// Access the binning of the results
+      const Binning& binning()  const   {  return m_binning;  }
+
+      /// Create rays from an origin to a cylinder (rmax,zmax) in equidistant bins of (eta,phi)
+      std::vector<Ray> etaPhiRays(const Vector3D& origin,
+                                  double rmax, double zmax,
+                                  int rays_per_bin = 1)  const;
+
+      /// Scan all rays in parallel. Previous results are reset.
+      void scan(const std::vector<Ray>& rays, double epsilon = MaterialManager::epsilon);
+
+      /// Number of rays accumulated per bin
+      const std::vector<long>& entries()  const    {  return m_entries;    }
+      /// Access total material budget
+      const Budget& total()  const                 {  return m_total;      }
+      /// Access material budget per subdetector
+      const std::vector<Budget>& detectors() const {  return m_detectors;  }
+      /// Access material budget per material
+      const std::vector<Budget>& materials() const {  return m_materials;  }
+    };
+  }    // End namespace rec
+}      // End namespace dd4hep
+#endif // DDREC_MATERIALSCANPARALLEL_H
@@ -597,6 +597,10 @@ namespace dd4hep {
        */
       virtual std::vector< std::pair< Vector3D, Vector3D> > getLines(unsigned nMax=100) ;
 
+      /** Access the transformation from the local frame of the surface volume to the world frame.
+       */
+      const TGeoMatrix& worldTransformation() const { return *_wtM ; }
+
     protected:
       void initialize() ;
 
@@ -0,0 +1,109 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+#ifndef DDREC_SURFACEBATCH_H
+#define DDREC_SURFACEBATCH_H
+
+#include "DDRec/ISurface.h"
+
+#include <vector>
+#include <cstddef>
+
+class TGeoShape;
+
+namespace dd4hep {
+  namespace rec {
+
+    /// Structure-of-arrays block of points in global coordinates
+    struct PointBlock {
+      const double* x { nullptr };
+      const double* y { nullptr };
+      const double* z { nullptr };
+      std::size_t   size { 0 };
+    };
+
+    /** Batch evaluation of distance and insideBounds for a group of surfaces.
+     *
+     *  The world transformation and the parameters of planar and cylindrical surfaces
+     *  (VolPlaneImpl, VolCylinderImpl) are flattened when the surface is added.
+     *  The evaluation then loops over a block of points without virtual dispatch
+     *  in a form the compiler can vectorize. Bounds given by TGeoBBox and TGeoTube
+     *  shapes are evaluated inline; other shapes fall back to TGeoShape::Contains
+     *  for the points close to the surface.
+     *
+     *  Surfaces of other types (cones, or user implementations deriving from
+     *  VolPlaneImpl/VolCylinderImpl) are evaluated point by point via the ISurface interface.
+     *  The results are identical to ISurface::distance and ISurface::insideBounds.
+     *
+     * @version 1.0
+     */
+    class SurfaceBatch {
+    public:
+      /// Surface evaluation kind
+      enum Kind   { PLANE, CYLINDER, GENERAL };
+      /// Bounds evaluation kind
+      enum Bounds { UNBOUNDED, BOX, TUBE, SHAPE };
+
+    private:
+      /// Flattened surface parameters
+      struct Entry  {
+        const ISurface*  surface  { nullptr };
+        const TGeoShape* shape    { nullptr };
+        Kind             kind     { GENERAL };
+        Bounds           bounds   { SHAPE };
+        /// Rotation (row-major, local to world) and translation of the surface volume
+        double           rot[9]   { 1e0, 0e0, 0e0, 0e0, 1e0, 0e0, 0e0, 0e0, 1e0 };
+        double           trans[3] { 0e0, 0e0, 0e0 };
+        /// Plane: world normal and offset: distance = n*p - d0
+        double           normal[3]{ 0e0, 0e0, 0e0 };
+        double           d0       { 0e0 };
+        /// Cylinder: radius
+        double           radius   { 0e0 };
+        /// Box bounds: origin and half lengths. Tube bounds: rmin^2, rmax^2, dz
+        double           b[6]     { 0e0, 0e0, 0e0, 0e0, 0e0, 0e0 };
+      };
+      std::vector<Entry> _entries ;
+
+      /// Transform a block of points to the local frame of the surface volume
+      static void toLocal(const Entry& e, const PointBlock& p, std::size_t first, std::size_t n,
+                          double* lx, double* ly, double* lz) ;
+
+    public:
+      /// Default constructor
+      SurfaceBatch() = default;
+      /// Initializing constructor
+      SurfaceBatch(const std::vector<const ISurface*>& surfaces);
+
+      /// Add a surface to the batch. Returns the index of the surface in the batch
+      std::size_t add(const ISurface* surface);
+
+      /// Number of surfaces in the batch
+      std::size_t size() const  {  return _entries.size();  }
+      /// Access the surface by index
+      const ISurface* surface(std::size_t i) const  {  return _entries[i].surface;  }
+      /// Access the evaluation kind of a surface
+      Kind kind(std::size_t i) const  {  return _entries[i].kind;  }
+
+      /// Distances of all points to the surface isurf. dist must hold p.size entries
+      void distance(std::size_t isurf, const PointBlock& p, double* dist) const;
+      /// Check if the points lie within the surface isurf. inside must hold p.size entries
+      void insideBounds(std::size_t isurf, const PointBlock& p, unsigned char* inside, double epsilon=1.e-4) const;
+
+      /// Distances of all points to all surfaces. Layout: dist[isurf * p.size + ipoint]
+      void distance(const PointBlock& p, double* dist) const;
+      /// Check the points against all surfaces. Layout: inside[isurf * p.size + ipoint]
+      void insideBounds(const PointBlock& p, unsigned char* inside, double epsilon=1.e-4) const;
+    };
+
+  } /* namespace rec */
+} /* namespace dd4hep */
+
+#endif // DDREC_SURFACEBATCH_H
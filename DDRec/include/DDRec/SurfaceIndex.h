@@ -0,0 +1,120 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+#ifndef DDREC_SURFACEINDEX_H
+#define DDREC_SURFACEINDEX_H
+
+#include "DDRec/ISurface.h"
+#include "DDRec/Vector3D.h"
+
+#include <vector>
+#include <map>
+
+namespace dd4hep {
+  namespace rec {
+
+    /// Spatial index (bounding volume hierarchy) over a set of surfaces
+    /**
+     *  The index is built from the axis aligned bounding boxes of the surfaces
+     *  in global coordinates. Bounded surfaces use the bounding box of the volume
+     *  the surface is attached to. Unbounded surfaces are tested on every query.
+     *
+     *  Supported queries:
+     *  - point queries: all surfaces within epsilon of a point.
+     *  - ray queries:   all surfaces crossed by a line segment or a helix
+     *                   ordered by the path length from the start point.
+     *
+     *  The index holds only references to the surfaces: the surface objects
+     *  must outlive the index.
+     *
+     * @version 1.0
+     */
+    class SurfaceIndex {
+    public:
+      /// Result of a ray query
+      struct Intersection  {
+        /// Reference to the crossed surface
+        ISurface* surface { nullptr };
+        /// Path length from the start point to the intersection
+        double    path    { 0e0 };
+        /// Global coordinates of the intersection
+        Vector3D  point   { };
+      };
+      typedef std::vector<Intersection> Intersections;
+
+    private:
+      /// Axis aligned bounding box
+      struct Box  {
+        double lo[3] {  1e300,  1e300,  1e300 };
+        double hi[3] { -1e300, -1e300, -1e300 };
+        void extend(const double* p);
+        void extend(const Box& b);
+        bool contains(const Vector3D& p, double epsilon)  const;
+        bool intersects(const Vector3D& p0, const Vector3D& inv_dir, double length, double epsilon)  const;
+      };
+      /// Node of the hierarchy. Leaves have count > 0
+      struct Node  {
+        Box      box;
+        unsigned left  { 0 };
+        unsigned right { 0 };
+        unsigned first { 0 };
+        unsigned count { 0 };
+      };
+
+      /// Flattened hierarchy. Root is the first entry
+      std::vector<Node>      _nodes     { };
+      /// Surfaces ordered by leaf
+      std::vector<ISurface*> _surfaces  { };
+      /// Bounding boxes ordered like _surfaces
+      std::vector<Box>       _boxes     { };
+      /// Surfaces without finite bounding box: always tested
+      std::vector<ISurface*> _unbounded { };
+      /// Maximal number of surfaces per leaf
+      unsigned               _leafSize  { 4 };
+
+      /// Recursive build of the hierarchy over the surface range [first, first+count)
+      unsigned buildNode(unsigned first, unsigned count);
+      /// Intersect a straight line segment with a single surface
+      void intersectSurface(ISurface* surf, const Vector3D& p0, const Vector3D& dir,
+                            double length, double path0, double epsilon, Intersections& result)  const;
+
+    public:
+      /// Default constructor
+      SurfaceIndex() = default;
+      /// Initializing constructor: build the index from a surface map
+      SurfaceIndex(const std::multimap<unsigned long, ISurface*>& surfaces, unsigned leaf_size = 4);
+
+      /// (Re-)build the index from a surface map
+      void build(const std::multimap<unsigned long, ISurface*>& surfaces, unsigned leaf_size = 4);
+
+      /// Number of indexed surfaces
+      std::size_t size()  const   {  return _surfaces.size() + _unbounded.size();  }
+
+      /// Access all surfaces within epsilon of the point p
+      std::vector<ISurface*> surfacesAt(const Vector3D& p, double epsilon = 1.e-4)  const;
+
+      /// Access the surfaces crossed by the line segment p0 -> p1 ordered by the distance to p0
+      Intersections intersect(const Vector3D& p0, const Vector3D& p1, double epsilon = 1.e-4)  const;
+
+      /** Access the surfaces crossed by a helix ordered by the path length.
+       *  The helix starts at pos with unit direction dir and has the signed curvature
+       *  kappa = 1/R in the plane perpendicular to the z-axis (positive: counter-clockwise).
+       *  The helix is approximated by chords of at most max_step; the sagitta error of each chord
+       *  is max_step^2*kappa/8.
+       */
+      Intersections intersectHelix(const Vector3D& pos, const Vector3D& dir, double kappa,
+                                   double length, double max_step = 1e0, double epsilon = 1.e-4)  const;
+    };
+
+  } /* namespace rec */
+} /* namespace dd4hep */
+
+#endif // DDREC_SURFACEINDEX_H
@@ -14,6 +14,7 @@
 #define DDREC_SURFACEMANAGER_H
 
 #include "DDRec/ISurface.h"
+#include "DDRec/SurfaceIndex.h"
 #include "DD4hep/Detector.h"
 #include <string>
 #include <map>
@@ -35,11 +36,17 @@ namespace dd4hep {
     class SurfaceManager {
 
       typedef std::map< std::string,  SurfaceMap > SurfaceMapsMap ;
+      typedef std::map< std::string,  SurfaceIndex > SurfaceIndexMap ;
 
     public:
       /// The constructor
       SurfaceManager(const Detector& theDetector);
 
+      /** Constructor optionally enabling the spatial index of the surfaces.
+       *  The index is built for every surface map together with the maps on first access.
+       */
+      SurfaceManager(const Detector& theDetector, bool buildIndex);
+
       /// No default constructor
       SurfaceManager() = delete ;
       
@@ -56,6 +63,13 @@ namespace dd4hep {
        */
       const SurfaceMap* map( const std::string& name ) const ;
 
+      /** Get the spatial index over the surfaces of the map with the given name
+       *  (e.g. "world" for all surfaces). Returns 0 if no such map exists or
+       *  the index was not enabled at construction.
+       *  @see SurfaceIndex
+       */
+      const SurfaceIndex* index( const std::string& name = "world" ) const ;
+
       
       ///create a string with all available maps and their size (number of surfaces)
       std::string toString() const ;
@@ -67,7 +81,9 @@ namespace dd4hep {
       void initialize(const Detector& theDetector) const;
 
       mutable SurfaceMapsMap  _map{} ;
+      mutable SurfaceIndexMap _index{} ;
       const Detector& _theDetector ;
+      bool _buildIndex { false } ;
       mutable std::once_flag  _initializedFlag{} ;
     };
 
@@ -0,0 +1,301 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+
+// Framework include files
+#include <DDRec/MaterialScanParallel.h>
+#include <DD4hep/Detector.h>
+#include <DD4hep/Printout.h>
+
+/// ROOT include files
+#include <TGeoManager.h>
+#include <TGeoNavigator.h>
+#include <TList.h>
+
+/// C/C++ include files
+#include <atomic>
+#include <thread>
+#include <exception>
+
+using namespace dd4hep;
+using namespace dd4hep::rec;
+
+#define MINSTEP 1.e-5
+
+/// Per-thread accumulation buffer
+class MaterialScanParallel::Worker  {
+public:
+  std::vector<long>                entries;
+  std::vector<double>              total_x0, total_lambda;
+  std::vector<std::vector<double> > det_x0, det_lambda;
+  std::vector<std::vector<double> > mat_x0, mat_lambda;
+
+  /// Initializing constructor
+  Worker(std::size_t nbins, std::size_t ndet, std::size_t nmat)
+    : entries(nbins, 0), total_x0(nbins, 0e0), total_lambda(nbins, 0e0),
+      det_x0(ndet), det_lambda(ndet), mat_x0(nmat), mat_lambda(nmat)
+  {
+  }
+  /// Add a contribution to a lazily allocated bin array
+  static void add(std::vector<double>& cont, std::size_t nbins, long bin, double value)   {
+    if ( cont.empty() ) cont.resize(nbins, 0e0);
+    cont[bin] += value;
+  }
+};
+
+namespace  {
+  /// Restore the maximal number of navigator threads of the geometry manager on exit
+  class MaxThreadsGuard  {
+    TGeoManager& m_manager;
+    Int_t        m_previous;
+  public:
+    MaxThreadsGuard(TGeoManager& mgr, int num_threads)
+      : m_manager(mgr), m_previous(mgr.GetMaxThreads())
+    {
+      if ( m_previous < num_threads ) m_manager.SetMaxThreads(num_threads);
+    }
+    ~MaxThreadsGuard()   {
+      if ( m_manager.GetMaxThreads() != m_previous ) m_manager.SetMaxThreads(m_previous);
+    }
+  };
+  /// Merge a worker buffer into the result
+  void merge(std::vector<double>& to, const std::vector<double>& from)   {
+    if ( from.empty() ) return;
+    if ( to.empty() ) to.resize(from.size(), 0e0);
+    for( std::size_t i = 0; i < from.size(); ++i )
+      to[i] += from[i];
+  }
+  /// Normalize the accumulated sums to the mean value per ray
+  void normalize(MaterialScanParallel::Budget& budget, const std::vector<long>& entries)   {
+    for( std::size_t i = 0; i < entries.size(); ++i )   {
+      if ( entries[i] > 0 )   {
+        budget.x0[i]     /= double(entries[i]);
+        budget.lambda[i] /= double(entries[i]);
+      }
+    }
+  }
+}
+
+/// Linear bin index from coordinates. -1 if out of range
+long MaterialScanParallel::Binning::index(double u, double v)  const   {
+  if ( u < umin || u >= umax || v < vmin || v >= vmax )
+    return -1;
+  long iu = long((u - umin) / (umax - umin) * nu);
+  long iv = long((v - vmin) / (vmax - vmin) * nv);
+  if ( iu >= nu ) iu = nu - 1;
+  if ( iv >= nv ) iv = nv - 1;
+  return iv * nu + iu;
+}
+
+/// Standard constructor. If scan is supplied, its selection criteria are used
+MaterialScanParallel::MaterialScanParallel(Detector& description, const MaterialScan* scan)
+  : m_detector(description)
+{
+  if ( scan )   {
+    m_selection = scan->selection();
+  }
+  for( const auto& [name, det] : m_detector.world().children() )   {
+    PlacedVolume pv = det.placement();
+    if ( pv.isValid() )   {
+      m_topNodes.emplace(pv.ptr(), m_detectors.size());
+      m_detectors.emplace_back(Budget { name, {}, {} });
+    }
+  }
+  TList* materials = m_detector.manager().GetListOfMaterials();
+  m_materials.resize(materials ? materials->GetSize() : 0);
+  for( std::size_t i = 0; i < m_materials.size(); ++i )   {
+    TGeoMaterial* mat = (TGeoMaterial*)materials->At(i);
+    m_materials[i].name = mat->GetName();
+    // TGeoMaterial::GetIndex caches the index on first call: do it here before
+    // the workers start to ensure the access is read-only within the threads.
+    mat->GetIndex();
+  }
+  m_total.name = "Total";
+  setNumThreads(0);
+}
+
+/// Default destructor
+MaterialScanParallel::~MaterialScanParallel()   {
+}
+
+/// Set the number of worker threads (<=0: hardware concurrency)
+void MaterialScanParallel::setNumThreads(int num_threads)   {
+  m_numThreads = num_threads > 0 ? num_threads : int(std::thread::hardware_concurrency());
+  if ( m_numThreads <= 0 ) m_numThreads = 1;
+}
+
+/// Set the binning of the results
+void MaterialScanParallel::setBinning(const Binning& binning)   {
+  if ( binning.nu <= 0 || binning.nv <= 0 || binning.umax <= binning.umin || binning.vmax <= binning.vmin )   {
+    except("MaterialScanParallel","+++ Invalid binning: u:[%d, %f, %f] v:[%d, %f, %f]",
+           binning.nu, binning.umin, binning.umax, binning.nv, binning.vmin, binning.vmax);
+  }
+  m_binning = binning;
+}
+
+/// Create rays from an origin to a cylinder (rmax,zmax) in equidistant bins of (eta,phi)
+std::vector<MaterialScanParallel::Ray>
+MaterialScanParallel::etaPhiRays(const Vector3D& origin, double rmax, double zmax, int rays_per_bin)  const  {
+  const Binning& b = m_binning;
+  const int    nsub = rays_per_bin > 0 ? rays_per_bin : 1;
+  const double du = (b.umax - b.umin) / double(b.nu * nsub);
+  const double dv = (b.vmax - b.vmin) / double(b.nv * nsub);
+  std::vector<Ray> rays;
+  rays.reserve(b.size() * nsub * nsub);
+  for( int iu = 0, nu = b.nu * nsub; iu < nu; ++iu )   {
+    double eta   = b.umin + (0.5 + iu) * du;
+    double theta = 2e0 * std::atan(std::exp(-eta));
+    double st    = std::sin(theta), ct = std::cos(theta);
+    double len   = std::min(st > 0e0 ? rmax / st : zmax, ct != 0e0 ? zmax / std::abs(ct) : rmax);
+    for( int iv = 0, nv = b.nv * nsub; iv < nv; ++iv )   {
+      double   phi = b.vmin + (0.5 + iv) * dv;
+      Vector3D dir(st * std::cos(phi), st * std::sin(phi), ct);
+      rays.emplace_back(Ray { origin, origin + len * dir, eta, phi });
+    }
+  }
+  return rays;
+}
+
+/// Scan a single ray with a given navigator and fill the worker buffers
+void MaterialScanParallel::scanRay(TGeoNavigator* nav, const Ray& ray, double epsilon, Worker& w)  const  {
+  long bin = m_binning.index(ray.u, ray.v);
+  if ( bin < 0 ) return;
+
+  Vector3D dir = ray.end - ray.start;
+  double   tot = dir.r();
+  if ( tot <= 0e0 ) return;
+  dir = dir.unit();
+  ++w.entries[bin];
+
+  const std::size_t nbins = m_binning.size();
+  auto top_node = [this, nav] ()  {
+    Int_t level = nav->GetLevel();
+    if ( level > 0 )   {
+      auto i = m_topNodes.find(nav->GetMother(level-1));
+      if ( i != m_topNodes.end() ) return long(i->second);
+    }
+    return -1L;
+  };
+  auto account = [this, &w, nbins, bin, epsilon] (const TGeoNode* node, long det, double length)  {
+    if ( length <= epsilon ) return;
+    if ( !m_selection.empty() && m_selection.find(node) == m_selection.end() ) return;
+    TGeoMaterial* mat = node->GetMedium()->GetMaterial();
+    double nx0     = length / mat->GetRadLen();
+    double nLambda = length / mat->GetIntLen();
+    w.total_x0[bin]     += nx0;
+    w.total_lambda[bin] += nLambda;
+    if ( det >= 0 )   {
+      Worker::add(w.det_x0[det], nbins, bin, nx0);
+      Worker::add(w.det_lambda[det], nbins, bin, nLambda);
+    }
+    Int_t imat = mat->GetIndex();
+    if ( imat >= 0 && std::size_t(imat) < w.mat_x0.size() )   {
+      Worker::add(w.mat_x0[imat], nbins, bin, nx0);
+      Worker::add(w.mat_lambda[imat], nbins, bin, nLambda);
+    }
+  };
+
+  const TGeoNode* node1 = nav->InitTrack(ray.start, dir);
+  if ( !node1 ) return;
+  long det1 = top_node();
+  bool empty = true;
+  // Same stepping algorithm as MaterialManager::materialsBetween
+  while ( !nav->IsOutside() )  {
+    TGeoNode* node2 = nav->FindNextBoundaryAndStep(500, 1);
+    if ( !node2 || nav->IsOutside() )
+      break;
+
+    double length = nav->GetStep();
+    if ( length < MINSTEP )   {
+      const double* p = nav->GetCurrentPoint();
+      nav->SetCurrentPoint(p[0] + MINSTEP * dir[0], p[1] + MINSTEP * dir[1], p[2] + MINSTEP * dir[2]);
+      length = nav->GetStep();
+      node2  = nav->FindNextBoundaryAndStep(500, 1);
+    }
+    Vector3D position(nav->GetCurrentPoint());
+    if ( (position - ray.start).r() > tot )   {
+      Vector3D previous(nav->GetLastPoint());
+      length = (ray.end - previous).r();
+      empty &= length <= epsilon;
+      account(node1, det1, length);
+      break;
+    }
+    empty &= length <= epsilon;
+    account(node1, det1, length);
+    node1 = node2;
+    det1  = top_node();
+  }
+  // Protect against empty list as MaterialManager::materialsBetween does:
+  // the full ray is accounted to the last volume seen.
+  if ( empty )   {
+    account(node1, det1, tot);
+  }
+}
+
+/// Scan all rays in parallel. Previous results are reset.
+void MaterialScanParallel::scan(const std::vector<Ray>& rays, double epsilon)   {
+  const std::size_t nbins = m_binning.size();
+  // Hand out rays in chunks: small enough to balance the load, large enough to limit contention
+  const std::size_t chunk = std::max(std::size_t(1), std::min(std::size_t(64), rays.size() / (16 * m_numThreads)));
+  TGeoManager& mgr = m_detector.manager();
+  int num_threads = std::max(1, std::min(m_numThreads, int((rays.size() + chunk - 1) / chunk)));
+
+  MaxThreadsGuard guard(mgr, num_threads);
+  std::vector<Worker> workers(num_threads, Worker(nbins, m_detectors.size(), m_materials.size()));
+  std::vector<std::exception_ptr> errors(num_threads);
+  std::vector<std::thread> threads;
+  std::atomic<std::size_t> next_ray { 0 };
+
+  printout(INFO,"MaterialScanParallel","+++ Scanning %ld rays with %d threads [%d x %d bins]",
+           rays.size(), num_threads, m_binning.nu, m_binning.nv);
+  for( int i = 0; i < num_threads; ++i )   {
+    threads.emplace_back([this, i, &mgr, &rays, &next_ray, &workers, &errors, epsilon, chunk] ()  {
+      TGeoNavigator* nav = mgr.AddNavigator();
+      try  {
+        for( std::size_t first = next_ray.fetch_add(chunk); first < rays.size(); first = next_ray.fetch_add(chunk) )  {
+          for( std::size_t j = first, last = std::min(first + chunk, rays.size()); j < last; ++j )
+            this->scanRay(nav, rays[j], epsilon, workers[i]);
+        }
+      }
+      catch(...)  {
+        errors[i] = std::current_exception();
+      }
+      mgr.RemoveNavigator(nav);
+    });
+  }
+  for( auto& t : threads ) t.join();
+  for( const auto& e : errors )  {
+    if ( e ) std::rethrow_exception(e);
+  }
+
+  // Merge the worker buffers
+  m_entries.assign(nbins, 0);
+  m_total.x0.assign(nbins, 0e0);
+  m_total.lambda.assign(nbins, 0e0);
+  for( auto& d : m_detectors ) d.x0.clear(), d.lambda.clear();
+  for( auto& m : m_materials ) m.x0.clear(), m.lambda.clear();
+  for( const auto& w : workers )   {
+    for( std::size_t i = 0; i < nbins; ++i ) m_entries[i] += w.entries[i];
+    merge(m_total.x0, w.total_x0);
+    merge(m_total.lambda, w.total_lambda);
+    for( std::size_t i = 0; i < m_detectors.size(); ++i )   {
+      merge(m_detectors[i].x0, w.det_x0[i]);
+      merge(m_detectors[i].lambda, w.det_lambda[i]);
+    }
+    for( std::size_t i = 0; i < m_materials.size(); ++i )   {
+      merge(m_materials[i].x0, w.mat_x0[i]);
+      merge(m_materials[i].lambda, w.mat_lambda[i]);
+    }
+  }
+  normalize(m_total, m_entries);
+  for( auto& d : m_detectors ) if ( !d.x0.empty() ) normalize(d, m_entries);
+  for( auto& m : m_materials ) if ( !m.x0.empty() ) normalize(m, m_entries);
+}
@@ -20,6 +20,7 @@
 #include "DDRec/DetectorSurfaces.h"
 #include "DDRec/MaterialManager.h"
 #include "DDRec/MaterialScan.h"
+#include "DDRec/MaterialScanParallel.h"
 #include "DDRec/CellIDPositionConverter.h"
 #include "DDRec/Surface.h"
 #include "DDRec/SurfaceManager.h"
@@ -86,6 +87,7 @@ using namespace dd4hep::rec;
 #pragma link C++ class MaterialData+;
 #pragma link C++ class MaterialManager+;
 #pragma link C++ class MaterialScan+;
+#pragma link C++ class MaterialScanParallel;
 #pragma link C++ class VolSurfaceBase+;
 #pragma link C++ class VolSurface+;
 #pragma link C++ class VolSurfaceList+;
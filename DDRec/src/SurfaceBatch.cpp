@@ -0,0 +1,209 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+#include "DDRec/SurfaceBatch.h"
+#include "DDRec/Surface.h"
+
+#include "TGeoBBox.h"
+#include "TGeoTube.h"
+#include "TGeoMatrix.h"
+
+#include <cmath>
+#include <typeinfo>
+
+namespace dd4hep {
+  namespace rec {
+
+    namespace {
+      /// Number of points transformed to the local frame at once
+      constexpr std::size_t BLOCK_SIZE = 256 ;
+    }
+
+    SurfaceBatch::SurfaceBatch(const std::vector<const ISurface*>& surfaces) {
+      _entries.reserve( surfaces.size() ) ;
+      for( const auto* s : surfaces ) add( s ) ;
+    }
+
+    std::size_t SurfaceBatch::add(const ISurface* s) {
+      Entry e ;
+      e.surface = s ;
+      const Surface* surf = dynamic_cast<const Surface*>( s ) ;
+      if( surf ){
+        VolSurface vs = surf->volSurface() ;
+        const std::type_info& typ = typeid( *vs.ptr() ) ;
+        // Only the exact implementations: user classes may override distance or bounds
+        if(      typ == typeid( VolPlaneImpl ) )    e.kind = PLANE ;
+        else if( typ == typeid( VolCylinderImpl ) ) e.kind = CYLINDER ;
+        if( e.kind != GENERAL ){
+          const TGeoMatrix& m = surf->worldTransformation() ;
+          const double* r = m.GetRotationMatrix() ;
+          const double* t = m.GetTranslation() ;
+          for( int i=0 ; i<9 ; ++i ) e.rot[i]   = r[i] ;
+          for( int i=0 ; i<3 ; ++i ) e.trans[i] = t[i] ;
+
+          const Vector3D& o = vs.origin() ;
+          if( e.kind == PLANE ){
+            // (R^T (p - T) - o) * n  =  p * (R n)  -  ( T * (R n) + o * n )
+            const Vector3D n = vs.normal() ;
+            for( int i=0 ; i<3 ; ++i )
+              e.normal[i] = r[3*i] * n[0] + r[3*i+1] * n[1] + r[3*i+2] * n[2] ;
+            e.d0 = t[0] * e.normal[0] + t[1] * e.normal[1] + t[2] * e.normal[2] + o * n ;
+          }
+          else {
+            e.radius = o.rho() ;
+          }
+
+          e.shape = vs.volume()->GetShape() ;
+          if( vs.type().isUnbounded() ){
+            e.bounds = UNBOUNDED ;
+          }
+          else if( e.shape->IsA() == TGeoBBox::Class() ){
+            const TGeoBBox* box = static_cast<const TGeoBBox*>( e.shape ) ;
+            const double* org = box->GetOrigin() ;
+            e.bounds = BOX ;
+            e.b[0] = org[0] ;  e.b[1] = org[1] ;  e.b[2] = org[2] ;
+            e.b[3] = box->GetDX() ;  e.b[4] = box->GetDY() ;  e.b[5] = box->GetDZ() ;
+          }
+          else if( e.shape->IsA() == TGeoTube::Class() ){
+            const TGeoTube* tube = static_cast<const TGeoTube*>( e.shape ) ;
+            e.bounds = TUBE ;
+            e.b[0] = tube->GetRmin() * tube->GetRmin() ;
+            e.b[1] = tube->GetRmax() * tube->GetRmax() ;
+            e.b[2] = tube->GetDz() ;
+          }
+          else {
+            e.bounds = SHAPE ;
+          }
+        }
+      }
+      _entries.emplace_back( e ) ;
+      return _entries.size() - 1 ;
+    }
+
+    void SurfaceBatch::toLocal(const Entry& e, const PointBlock& p, std::size_t first, std::size_t n,
+                               double* lx, double* ly, double* lz) {
+      const double r0 = e.rot[0], r1 = e.rot[1], r2 = e.rot[2] ;
+      const double r3 = e.rot[3], r4 = e.rot[4], r5 = e.rot[5] ;
+      const double r6 = e.rot[6], r7 = e.rot[7], r8 = e.rot[8] ;
+      const double tx = e.trans[0], ty = e.trans[1], tz = e.trans[2] ;
+      const double* __restrict__ px = p.x + first ;
+      const double* __restrict__ py = p.y + first ;
+      const double* __restrict__ pz = p.z + first ;
+      for( std::size_t i=0 ; i<n ; ++i ){
+        const double dx = px[i] - tx, dy = py[i] - ty, dz = pz[i] - tz ;
+        lx[i] = r0 * dx + r3 * dy + r6 * dz ;
+        ly[i] = r1 * dx + r4 * dy + r7 * dz ;
+        lz[i] = r2 * dx + r5 * dy + r8 * dz ;
+      }
+    }
+
+    void SurfaceBatch::distance(std::size_t isurf, const PointBlock& p, double* dist) const {
+      const Entry& e = _entries[isurf] ;
+      switch( e.kind ){
+      case PLANE: {
+        const double nx = e.normal[0], ny = e.normal[1], nz = e.normal[2], d0 = e.d0 ;
+        const double* __restrict__ px = p.x ;
+        const double* __restrict__ py = p.y ;
+        const double* __restrict__ pz = p.z ;
+        for( std::size_t i=0 ; i<p.size ; ++i )
+          dist[i] = nx * px[i] + ny * py[i] + nz * pz[i] - d0 ;
+        break ;
+      }
+      case CYLINDER: {
+        double lx[BLOCK_SIZE], ly[BLOCK_SIZE], lz[BLOCK_SIZE] ;
+        const double radius = e.radius ;
+        for( std::size_t first=0 ; first<p.size ; first += BLOCK_SIZE ){
+          const std::size_t n = std::min( BLOCK_SIZE, p.size - first ) ;
+          toLocal( e, p, first, n, lx, ly, lz ) ;
+          double* __restrict__ d = dist + first ;
+          for( std::size_t i=0 ; i<n ; ++i )
+            d[i] = std::sqrt( lx[i] * lx[i] + ly[i] * ly[i] ) - radius ;
+        }
+        break ;
+      }
+      default:
+        for( std::size_t i=0 ; i<p.size ; ++i )
+          dist[i] = e.surface->distance( Vector3D( p.x[i], p.y[i], p.z[i] ) ) ;
+        break ;
+      }
+    }
+
+    void SurfaceBatch::insideBounds(std::size_t isurf, const PointBlock& p, unsigned char* inside, double epsilon) const {
+      const Entry& e = _entries[isurf] ;
+      if( e.kind == GENERAL ){
+        for( std::size_t i=0 ; i<p.size ; ++i )
+          inside[i] = e.surface->insideBounds( Vector3D( p.x[i], p.y[i], p.z[i] ), epsilon ) ;
+        return ;
+      }
+      double lx[BLOCK_SIZE], ly[BLOCK_SIZE], lz[BLOCK_SIZE], d[BLOCK_SIZE] ;
+      for( std::size_t first=0 ; first<p.size ; first += BLOCK_SIZE ){
+        const std::size_t n = std::min( BLOCK_SIZE, p.size - first ) ;
+        unsigned char* __restrict__ in = inside + first ;
+        PointBlock blk { p.x + first, p.y + first, p.z + first, n } ;
+
+        toLocal( e, p, first, n, lx, ly, lz ) ;
+        if( e.kind == PLANE ){
+          distance( isurf, blk, d ) ;
+        }
+        else {
+          const double radius = e.radius ;
+          for( std::size_t i=0 ; i<n ; ++i )
+            d[i] = std::sqrt( lx[i] * lx[i] + ly[i] * ly[i] ) - radius ;
+        }
+        for( std::size_t i=0 ; i<n ; ++i )
+          in[i] = std::abs( d[i] ) < epsilon ;
+
+        switch( e.bounds ){
+        case BOX: {
+          const double ox = e.b[0], oy = e.b[1], oz = e.b[2] ;
+          const double dx = e.b[3], dy = e.b[4], dz = e.b[5] ;
+          for( std::size_t i=0 ; i<n ; ++i ){
+            in[i] &= ( std::abs( lx[i] - ox ) <= dx ) &
+                     ( std::abs( ly[i] - oy ) <= dy ) &
+                     ( std::abs( lz[i] - oz ) <= dz ) ;
+          }
+          break ;
+        }
+        case TUBE: {
+          const double rmin2 = e.b[0], rmax2 = e.b[1], dz = e.b[2] ;
+          for( std::size_t i=0 ; i<n ; ++i ){
+            const double r2 = lx[i] * lx[i] + ly[i] * ly[i] ;
+            in[i] &= ( std::abs( lz[i] ) <= dz ) & ( r2 >= rmin2 ) & ( r2 <= rmax2 ) ;
+          }
+          break ;
+        }
+        case SHAPE:
+          for( std::size_t i=0 ; i<n ; ++i ){
+            if( in[i] ){
+              double local[3] = { lx[i], ly[i], lz[i] } ;
+              in[i] = e.shape->Contains( local ) ;
+            }
+          }
+          break ;
+        case UNBOUNDED:
+        default:
+          break ;
+        }
+      }
+    }
+
+    void SurfaceBatch::distance(const PointBlock& p, double* dist) const {
+      for( std::size_t i=0 ; i<_entries.size() ; ++i )
+        distance( i, p, dist + i * p.size ) ;
+    }
+
+    void SurfaceBatch::insideBounds(const PointBlock& p, unsigned char* inside, double epsilon) const {
+      for( std::size_t i=0 ; i<_entries.size() ; ++i )
+        insideBounds( i, p, inside + i * p.size, epsilon ) ;
+    }
+
+  } // namespace
+}// namespace
@@ -0,0 +1,310 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//
+//==========================================================================
+#include "DDRec/SurfaceIndex.h"
+#include "DDRec/Surface.h"
+
+#include "TGeoBBox.h"
+#include "TGeoMatrix.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace dd4hep {
+  namespace rec {
+
+    namespace {
+      /// Number of samples to detect sign changes of the distance for general surfaces
+      constexpr int    NUM_SAMPLES  = 16 ;
+      /// Number of bisection steps to locate the intersection for general surfaces
+      constexpr int    NUM_BISECT   = 40 ;
+    }
+
+    void SurfaceIndex::Box::extend(const double* p) {
+      for( int i=0 ; i<3 ; ++i ){
+        lo[i] = std::min( lo[i], p[i] ) ;
+        hi[i] = std::max( hi[i], p[i] ) ;
+      }
+    }
+
+    void SurfaceIndex::Box::extend(const Box& b) {
+      extend( b.lo ) ;
+      extend( b.hi ) ;
+    }
+
+    bool SurfaceIndex::Box::contains(const Vector3D& p, double epsilon) const {
+      for( int i=0 ; i<3 ; ++i ){
+        if( p[i] < lo[i] - epsilon || p[i] > hi[i] + epsilon )
+          return false ;
+      }
+      return true ;
+    }
+
+    /// Slab test of the segment p0 + t * dir, t in [0,length], against the box
+    bool SurfaceIndex::Box::intersects(const Vector3D& p0, const Vector3D& inv_dir, double length, double epsilon) const {
+      double tmin = 0e0, tmax = length ;
+      for( int i=0 ; i<3 ; ++i ){
+        double t1 = ( lo[i] - epsilon - p0[i] ) * inv_dir[i] ;
+        double t2 = ( hi[i] + epsilon - p0[i] ) * inv_dir[i] ;
+        if( std::isnan( t1 ) || std::isnan( t2 ) ) {
+          // segment parallel to the slab and on its boundary
+          if( p0[i] < lo[i] - epsilon || p0[i] > hi[i] + epsilon ) return false ;
+          continue ;
+        }
+        tmin = std::max( tmin, std::min( t1, t2 ) ) ;
+        tmax = std::min( tmax, std::max( t1, t2 ) ) ;
+        if( tmin > tmax ) return false ;
+      }
+      return true ;
+    }
+
+    SurfaceIndex::SurfaceIndex(const std::multimap<unsigned long, ISurface*>& surfaces, unsigned leaf_size) {
+      build( surfaces, leaf_size ) ;
+    }
+
+    void SurfaceIndex::build(const std::multimap<unsigned long, ISurface*>& surfaces, unsigned leaf_size) {
+      _nodes.clear() ;
+      _surfaces.clear() ;
+      _boxes.clear() ;
+      _unbounded.clear() ;
+      _leafSize = std::max( 1u, leaf_size ) ;
+
+      for( const auto& entry : surfaces ){
+        ISurface* isurf = entry.second ;
+        Surface*  surf  = dynamic_cast<Surface*>( isurf ) ;
+        const TGeoBBox* bbox = surf ? dynamic_cast<const TGeoBBox*>( surf->volume()->GetShape() ) : nullptr ;
+        if( !bbox || isurf->type().isUnbounded() ){
+          _unbounded.emplace_back( isurf ) ;
+          continue ;
+        }
+        // Transform the corners of the volume's bounding box to the world frame
+        const double*   org  = bbox->GetOrigin() ;
+        const double    d[3] = { bbox->GetDX(), bbox->GetDY(), bbox->GetDZ() } ;
+        const TGeoMatrix& wtm = surf->worldTransformation() ;
+        Box box ;
+        for( int corner=0 ; corner<8 ; ++corner ){
+          double local[3], global[3] ;
+          for( int i=0 ; i<3 ; ++i )
+            local[i] = org[i] + ( ( corner >> i ) & 1 ? d[i] : -d[i] ) ;
+          wtm.LocalToMaster( local, global ) ;
+          box.extend( global ) ;
+        }
+        _surfaces.emplace_back( isurf ) ;
+        _boxes.emplace_back( box ) ;
+      }
+      if( !_surfaces.empty() ){
+        _nodes.reserve( 2 * _surfaces.size() / _leafSize + 1 ) ;
+        buildNode( 0, _surfaces.size() ) ;
+      }
+    }
+
+    unsigned SurfaceIndex::buildNode(unsigned first, unsigned count) {
+      unsigned idx = _nodes.size() ;
+      _nodes.emplace_back() ;
+      Box box, centers ;
+      for( unsigned i=first ; i<first+count ; ++i ){
+        const Box& b = _boxes[i] ;
+        double c[3] = { 0.5*(b.lo[0]+b.hi[0]), 0.5*(b.lo[1]+b.hi[1]), 0.5*(b.lo[2]+b.hi[2]) } ;
+        box.extend( b ) ;
+        centers.extend( c ) ;
+      }
+      _nodes[idx].box = box ;
+      if( count <= _leafSize ){
+        _nodes[idx].first = first ;
+        _nodes[idx].count = count ;
+        return idx ;
+      }
+      // median split along the longest extent of the box centers
+      int axis = 0 ;
+      for( int i=1 ; i<3 ; ++i ){
+        if( centers.hi[i]-centers.lo[i] > centers.hi[axis]-centers.lo[axis] ) axis = i ;
+      }
+      std::vector<unsigned> order( count ) ;
+      for( unsigned i=0 ; i<count ; ++i ) order[i] = first + i ;
+      unsigned half = count / 2 ;
+      std::nth_element( order.begin(), order.begin() + half, order.end(),
+                        [this, axis](unsigned a, unsigned b){
+                          return _boxes[a].lo[axis]+_boxes[a].hi[axis] < _boxes[b].lo[axis]+_boxes[b].hi[axis] ;
+                        } ) ;
+      std::vector<ISurface*> surfs( count ) ;
+      std::vector<Box>       boxes( count ) ;
+      for( unsigned i=0 ; i<count ; ++i ){
+        surfs[i] = _surfaces[order[i]] ;
+        boxes[i] = _boxes[order[i]] ;
+      }
+      std::copy( surfs.begin(), surfs.end(), _surfaces.begin() + first ) ;
+      std::copy( boxes.begin(), boxes.end(), _boxes.begin() + first ) ;
+
+      unsigned left  = buildNode( first, half ) ;
+      unsigned right = buildNode( first + half, count - half ) ;
+      _nodes[idx].left  = left ;
+      _nodes[idx].right = right ;
+      return idx ;
+    }
+
+    std::vector<ISurface*> SurfaceIndex::surfacesAt(const Vector3D& p, double epsilon) const {
+      std::vector<ISurface*> result ;
+      if( !_nodes.empty() ){
+        std::vector<unsigned> stack { 0 } ;
+        while( !stack.empty() ){
+          const Node& node = _nodes[stack.back()] ;
+          stack.pop_back() ;
+          if( !node.box.contains( p, epsilon ) )
+            continue ;
+          if( node.count > 0 ){
+            for( unsigned i=node.first ; i<node.first+node.count ; ++i ){
+              if( _boxes[i].contains( p, epsilon ) && _surfaces[i]->insideBounds( p, epsilon ) )
+                result.emplace_back( _surfaces[i] ) ;
+            }
+            continue ;
+          }
+          stack.emplace_back( node.left ) ;
+          stack.emplace_back( node.right ) ;
+        }
+      }
+      for( ISurface* surf : _unbounded ){
+        if( surf->insideBounds( p, epsilon ) )
+          result.emplace_back( surf ) ;
+      }
+      return result ;
+    }
+
+    void SurfaceIndex::intersectSurface(ISurface* surf, const Vector3D& p0, const Vector3D& dir,
+                                        double length, double path0, double epsilon, Intersections& result) const {
+      auto accept = [&]( double t ){
+        if( t < 0e0 || t > length ) return ;
+        Vector3D p = p0 + t * dir ;
+        if( surf->insideBounds( p, epsilon ) )
+          result.emplace_back( Intersection{ surf, path0 + t, p } ) ;
+      } ;
+      const SurfaceType& type = surf->type() ;
+
+      if( type.isPlane() ){
+        const Vector3D n = surf->normal() ;
+        double denom = n * dir ;
+        if( std::abs( denom ) > std::numeric_limits<double>::epsilon() )
+          accept( ( n * ( surf->origin() - p0 ) ) / denom ) ;
+        return ;
+      }
+      const ICylinder* cyl = type.isCone() ? nullptr : dynamic_cast<const ICylinder*>( surf ) ;
+      if( type.isCylinder() && cyl ){
+        // solve |(p0 + t*dir - c)_perp|^2 = R^2 w.r.t. the cylinder axis
+        const Vector3D axis = surf->v().unit() ;
+        const Vector3D w    = p0 - cyl->center() ;
+        const Vector3D dp   = dir - ( dir * axis ) * axis ;
+        const Vector3D wp   = w   - ( w   * axis ) * axis ;
+        const double   r    = cyl->radius() ;
+        double a = dp * dp, b = 2e0 * ( dp * wp ), c = wp * wp - r * r ;
+        if( a <= std::numeric_limits<double>::epsilon() ) return ;
+        double disc = b * b - 4e0 * a * c ;
+        if( disc < 0e0 ) return ;
+        double sq = std::sqrt( disc ) ;
+        accept( ( -b - sq ) / ( 2e0 * a ) ) ;
+        if( sq > 0e0 ) accept( ( -b + sq ) / ( 2e0 * a ) ) ;
+        return ;
+      }
+      // general surface: detect sign changes of the signed distance and bisect
+      double t_prev = 0e0 ;
+      double d_prev = surf->distance( p0 ) ;
+      for( int i=1 ; i<=NUM_SAMPLES ; ++i ){
+        double t = length * i / NUM_SAMPLES ;
+        double d = surf->distance( p0 + t * dir ) ;
+        if( ( d_prev <= 0e0 && d >= 0e0 ) || ( d_prev >= 0e0 && d <= 0e0 ) ){
+          double lo = t_prev, hi = t, d_lo = d_prev ;
+          for( int j=0 ; j<NUM_BISECT && hi-lo > epsilon ; ++j ){
+            double mid = 0.5 * ( lo + hi ) ;
+            double d_mid = surf->distance( p0 + mid * dir ) ;
+            if( ( d_lo <= 0e0 ) == ( d_mid <= 0e0 ) ) { lo = mid ; d_lo = d_mid ; }
+            else                                      { hi = mid ; }
+          }
+          accept( 0.5 * ( lo + hi ) ) ;
+        }
+        t_prev = t ;
+        d_prev = d ;
+      }
+    }
+
+    SurfaceIndex::Intersections SurfaceIndex::intersect(const Vector3D& p0, const Vector3D& p1, double epsilon) const {
+      Intersections result ;
+      Vector3D d = p1 - p0 ;
+      double length = d.r() ;
+      if( length <= 0e0 ) return result ;
+      const Vector3D dir = d.unit() ;
+      const Vector3D inv_dir( 1e0/dir.x(), 1e0/dir.y(), 1e0/dir.z() ) ;
+
+      if( !_nodes.empty() ){
+        std::vector<unsigned> stack { 0 } ;
+        while( !stack.empty() ){
+          const Node& node = _nodes[stack.back()] ;
+          stack.pop_back() ;
+          if( !node.box.intersects( p0, inv_dir, length, epsilon ) )
+            continue ;
+          if( node.count > 0 ){
+            for( unsigned i=node.first ; i<node.first+node.count ; ++i ){
+              if( _boxes[i].intersects( p0, inv_dir, length, epsilon ) )
+                intersectSurface( _surfaces[i], p0, dir, length, 0e0, epsilon, result ) ;
+            }
+            continue ;
+          }
+          stack.emplace_back( node.left ) ;
+          stack.emplace_back( node.right ) ;
+        }
+      }
+      for( ISurface* surf : _unbounded )
+        intersectSurface( surf, p0, dir, length, 0e0, epsilon, result ) ;
+
+      std::sort( result.begin(), result.end(),
+                 []( const Intersection& a, const Intersection& b ){ return a.path < b.path ; } ) ;
+      return result ;
+    }
+
+    SurfaceIndex::Intersections SurfaceIndex::intersectHelix(const Vector3D& pos, const Vector3D& dir, double kappa,
+                                                             double length, double max_step, double epsilon) const {
+      Intersections result ;
+      if( length <= 0e0 || max_step <= 0e0 ) return result ;
+
+      const Vector3D t0 = dir.unit() ;
+      const double   st = std::sqrt( t0.x()*t0.x() + t0.y()*t0.y() ) ;   // sin(lambda): transverse fraction
+      const double   phi0 = std::atan2( t0.y(), t0.x() ) ;
+      auto point_at = [&]( double s ){
+        if( std::abs( kappa ) * st * s < 1e-9 )
+          return pos + s * t0 ;
+        double phi = phi0 + kappa * st * s ;
+        return Vector3D( pos.x() + ( std::sin( phi ) - std::sin( phi0 ) ) / kappa,
+                         pos.y() - ( std::cos( phi ) - std::cos( phi0 ) ) / kappa,
+                         pos.z() + t0.z() * s ) ;
+      } ;
+      int nsteps = int( std::ceil( length / max_step ) ) ;
+      Vector3D p_prev = pos ;
+      double   s_prev = 0e0 ;
+      for( int i=1 ; i<=nsteps ; ++i ){
+        double   s = std::min( length, i * max_step ) ;
+        Vector3D p = point_at( s ) ;
+        Intersections chord = intersect( p_prev, p, epsilon ) ;
+        double chord_len = ( p - p_prev ).r() ;
+        double scale = chord_len > 0e0 ? ( s - s_prev ) / chord_len : 1e0 ;
+        for( auto& hit : chord ){
+          hit.path = s_prev + hit.path * scale ;
+          // avoid double counting of intersections located at the chord boundaries
+          if( !result.empty() && result.back().surface == hit.surface &&
+              std::abs( result.back().path - hit.path ) < epsilon )
+            continue ;
+          result.emplace_back( hit ) ;
+        }
+        p_prev = p ;
+        s_prev = s ;
+      }
+      return result ;
+    }
+
+  } // namespace
+}// namespace
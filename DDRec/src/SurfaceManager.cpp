@@ -30,6 +30,11 @@ namespace dd4hep {
       VolumeManager::getVolumeManager(theDetector);
 
     }
+
+    SurfaceManager::SurfaceManager(const Detector& theDetector, bool buildIndex)
+      : SurfaceManager(theDetector) {
+      _buildIndex = buildIndex ;
+    }
     
     
     const SurfaceMap* SurfaceManager::map( const std::string& name ) const {
@@ -46,6 +51,20 @@ namespace dd4hep {
       return nullptr ;
     }
 
+    const SurfaceIndex* SurfaceManager::index( const std::string& name ) const {
+
+      std::call_once( _initializedFlag, &SurfaceManager::initialize, this, _theDetector ) ;
+
+      SurfaceIndexMap::const_iterator it = _index.find( name ) ;
+
+      if( it != _index.end() ){
+
+        return & it->second ;
+      }
+
+      return nullptr ;
+    }
+
     void SurfaceManager::initialize(const Detector& description) const {
       
       for(const auto& type : description.detectorTypes()) {
@@ -77,6 +96,12 @@ namespace dd4hep {
         }
       }
 
+      if( _buildIndex ){
+        for( const auto& m : _map ){
+          _index[ m.first ].build( m.second ) ;
+        }
+      }
+
       printout(INFO,"SurfaceManager","%s" , description.extension<SurfaceManager>()->toString().c_str() );
 
     }
@@ -89,7 +114,10 @@ namespace dd4hep {
  
       for( SurfaceMapsMap::const_iterator mi = _map.begin() ; mi != _map.end() ; ++mi ) {
 	
-        sstr << "  key: " <<  mi->first << " \t number of surfaces : " << mi->second.size() << std::endl ; 
+        sstr << "  key: " <<  mi->first << " \t number of surfaces : " << mi->second.size() ;
+        if( _index.find( mi->first ) != _index.end() )
+          sstr << " \t [indexed]" ;
+        sstr << std::endl ;
       }
       sstr << "---------------------------------------------------------------- " << std::endl ;
 
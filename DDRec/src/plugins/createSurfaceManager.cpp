@@ -16,6 +16,8 @@
 
 #include "DDRec/SurfaceManager.h"
 
+#include <cstring>
+
 namespace dd4hep{
   namespace rec{
     
@@ -29,6 +31,8 @@ namespace dd4hep{
 
     *  \brief Plugin that creates a SurfaceManager object and attaches it to description as a user extension object.
     *
+    *  Optional argument: -index  Build the spatial index (SurfaceIndex) over all surface maps.
+    *
     @}
     *
     *  @author  F.Gaede, CERN/DESY
@@ -37,12 +41,19 @@ namespace dd4hep{
     */
 
 
-    static long createSurfaceManager(Detector& description, int /*argc*/, char** /*argv*/) {
+    static long createSurfaceManager(Detector& description, int argc, char** argv) {
+
+      bool buildIndex = false ;
+      for( int i = 0; i < argc && argv[i]; ++i ) {
+        if( ::strcmp(argv[i], "-index") == 0 ) buildIndex = true ;
+      }
 
       printout(INFO,"InstallSurfaceManager","**** running plugin InstallSurfaceManager ! " );
       printout(INFO,"InstallSurfaceManager","**** the map of surfaces will be created on first access ! " );
+      if( buildIndex )
+        printout(INFO,"InstallSurfaceManager","**** the spatial index of the surfaces will be built with the maps ! " );
 
-      description.addExtension<SurfaceManager>(  new SurfaceManager(description) ) ;
+      description.addExtension<SurfaceManager>(  new SurfaceManager(description, buildIndex) ) ;
 
 
       return 1;
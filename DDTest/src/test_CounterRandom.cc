@@ -0,0 +1,107 @@
+#include "DD4hep/DDTest.h"
+
+#include "DD4hep/CounterRandom.h"
+
+#include <exception>
+#include <iostream>
+#include <vector>
+
+using namespace std ;
+using namespace dd4hep ;
+
+// this should be the first line in your test
+static DDTest test( "CounterRandom" ) ;
+//=============================================================================
+
+namespace {
+  /// Check one Philox4x32-10 known answer vector of the reference implementation
+  bool known_answer( const uint32_t (&ctr)[4], const uint32_t (&key)[2], const uint32_t (&expected)[4] )  {
+    uint32_t out[4] ;
+    Philox4x32::generate( ctr, key, out ) ;
+    return out[0] == expected[0] && out[1] == expected[1] && out[2] == expected[2] && out[3] == expected[3] ;
+  }
+}
+
+int main(int /* argc */, char** /* argv */ ){
+
+  test.log( "test the counter based random number streams" );
+
+  try{
+
+    // ----- write your tests in here -------------------------------------
+
+    // known answer tests of Random123 for Philox4x32-10
+    test( known_answer( {0,0,0,0}, {0,0}, {0x6627e8d5,0xe169c58d,0xbc57ac4c,0x9b00dbd8} ) ,
+          " Philox4x32-10 with zero counter and key " ) ;
+    test( known_answer( {0xffffffff,0xffffffff,0xffffffff,0xffffffff}, {0xffffffff,0xffffffff},
+                        {0x408f276d,0x41c83b0e,0xa20bc7c6,0x6d5451fd} ) ,
+          " Philox4x32-10 with maximal counter and key " ) ;
+    test( known_answer( {0x243f6a88,0x85a308d3,0x13198a2e,0x03707344}, {0xa4093822,0x299f31d0},
+                        {0xd16cfe09,0x94fdcceb,0x5001e420,0x24126ea1} ) ,
+          " Philox4x32-10 with the digits of pi " ) ;
+
+    // the stream is defined by seed, run, event, name and index
+    const size_t num = 1001 ;
+    CounterRandomStream s1( 12345, 1, 7, "Gun" ), s2( 12345, 1, 7, "Gun" ) ;
+    vector<double> r1( num ), r2( num ) ;
+    bool in_range = true ;
+    for( size_t i = 0; i < num; ++i ){
+      r1[i] = s1.rndm() ;
+      r2[i] = s2.rndm() ;
+      in_range = in_range && r1[i] > 0e0 && r1[i] <= 1e0 ;
+    }
+    test( r1 == r2 , " same stream for the same parameters " ) ;
+    test( in_range , " random numbers in the interval ]0,1] " ) ;
+    test( s1.position() , uint64_t(2 * num) , " two words per double " ) ;
+
+    CounterRandomStream other[] = { CounterRandomStream( 54321, 1, 7, "Gun" ),
+                                    CounterRandomStream( 12345, 2, 7, "Gun" ),
+                                    CounterRandomStream( 12345, 1, 8, "Gun" ),
+                                    CounterRandomStream( 12345, 1, 7, "Smearing" ),
+                                    CounterRandomStream( 12345, 1, 7, "Gun", 1 ) } ;
+    for( auto& s : other )
+      test( s.rndm() != r1[0] , " different stream for different parameters " ) ;
+
+    // reset and seek reproduce the stream at any position
+    s2.reset( 12345, 1, 7, "Gun" ) ;
+    test( s2.rndm() , r1[0] , " same numbers after reset " ) ;
+    s2.seek( 2 * 500 ) ;
+    test( s2.rndm() , r1[500] , " same numbers after seek to a block boundary " ) ;
+    s2.seek( 2 * 333 ) ;
+    test( s2.rndm() , r1[333] , " same numbers after seek into a block " ) ;
+    test( s2.position() , uint64_t(2 * 334) , " position after seek " ) ;
+
+    // bulk draws yield the same numbers as single draws at any word offset
+    for( uint64_t offset : { 0, 1, 2, 3 } ){
+      CounterRandomStream single( 12345, 1, 7, "Gun" ), bulk( 12345, 1, 7, "Gun" ) ;
+      single.seek( offset ) ;
+      bulk.seek( offset ) ;
+      vector<double> d1( num ), d2( num ) ;
+      for( auto& d : d1 ) d = single.rndm() ;
+      bulk.rndmArray( num, d2.data() ) ;
+      test( d1 == d2 , " bulk double draws at offset " + to_string(offset) ) ;
+      test( bulk.position() , single.position() , " position after bulk double draws " ) ;
+      test( bulk.rndm() , single.rndm() , " next double after bulk draws " ) ;
+
+      vector<float> f1( num ), f2( num ) ;
+      single.seek( offset ) ;
+      bulk.seek( offset ) ;
+      bulk.rndmArray( num, f2.data() ) ;
+      single.rndmArray( 1, f1.data() ) ;
+      for( size_t i = 1; i < num; ++i ) single.rndmArray( 1, f1.data() + i ) ;
+      test( f1 == f2 , " bulk float draws at offset " + to_string(offset) ) ;
+      test( bulk.position() , single.position() , " position after bulk float draws " ) ;
+    }
+
+    // --------------------------------------------------------------------
+  } catch( exception &e ){
+    //} catch( ... ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
+
+//=============================================================================
@@ -0,0 +1,149 @@
+#include "DD4hep/DDTest.h"
+
+#include "DDG4/Geant4Action.h"
+#include "DDG4/Geant4ActionProfiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+using namespace std ;
+using namespace dd4hep ;
+using namespace dd4hep::sim ;
+
+// this should be the first line in your test
+static DDTest test( "Geant4ActionProfiler" ) ;
+//=============================================================================
+
+namespace {
+  /// Minimal action called through the action sequence helper
+  class CountingAction : public Geant4Action {
+  public:
+    unsigned long count = 0 ;
+    CountingAction( const string& nam ) : Geant4Action( nullptr, nam ) {}
+    void call( int value ) { if( value ) count += value ; }
+  } ;
+
+  /// The sequence call as it was before the profiler was added
+  /** Not inlined like the calls of the sequences in the simulation */
+  __attribute__((noinline))
+  void plain_call( Geant4Action::Actors<CountingAction>& actors, void (CountingAction::*pmf)(int), int a0 )  {
+    if( !actors.m_v.empty() )
+      for( const auto& o : actors.m_v )
+        (o->*pmf)(a0) ;
+  }
+
+  /// The sequence call with the profiler hook
+  __attribute__((noinline))
+  void sequence_call( Geant4Action::Actors<CountingAction>& actors, void (CountingAction::*pmf)(int), int a0 )  {
+    actors( pmf, a0 ) ;
+  }
+
+  /// Best time per sequence call in nano seconds of several repetitions
+  template <typename FUNC> double best_time( FUNC&& func, size_t num_calls )  {
+    double best = 1e99 ;
+    for( int rep = 0; rep < 7; ++rep ){
+      auto start = chrono::steady_clock::now() ;
+      for( size_t i = 0; i < num_calls; ++i ) func() ;
+      chrono::duration<double, nano> dt = chrono::steady_clock::now() - start ;
+      best = min( best, dt.count() / double(num_calls) ) ;
+    }
+    return best ;
+  }
+
+  size_t histogram_sum( const uint64_t (&histogram)[Geant4ActionProfile::NUM_BINS] )  {
+    size_t sum = 0 ;
+    for( auto h : histogram ) sum += h ;
+    return sum ;
+  }
+}
+
+int main(int /* argc */, char** /* argv */ ){
+
+  test.log( "test the action profiler of the DDG4 action sequences" );
+
+  try{
+
+    // ----- write your tests in here -------------------------------------
+
+    const size_t num_calls = 1000000 ;
+    Geant4Action::Actors<CountingAction> actors ;
+    for( int i = 0; i < 4; ++i )
+      actors.add( new CountingAction( "Action_" + to_string(i) ) ) ;
+    void (CountingAction::*pmf)(int) = &CountingAction::call ;
+
+    // disabled profiler: only print the cost, timing on shared test machines is noisy
+    Geant4ActionProfiler::enable( 0 ) ;
+    double t_plain = best_time( [&actors, pmf] () { plain_call( actors, pmf, 1 ) ; }, num_calls ) ;
+    double t_off   = best_time( [&actors, pmf] () { sequence_call( actors, pmf, 1 ) ; }, num_calls ) ;
+    test.log( "ns per sequence call: without profiler " + to_string(t_plain) + " profiler disabled " + to_string(t_off) ) ;
+    test( actors.m_v.front()->profile()->calls , uint64_t(0) , " no calls counted with disabled profiler " ) ;
+
+    // wall time statistics
+    Geant4ActionProfiler::enable( 1 ) ;
+    Geant4ActionProfiler::reset() ;
+    double t_on = best_time( [&actors, pmf] () { sequence_call( actors, pmf, 1 ) ; }, num_calls / 10 ) ;
+    test.log( "ns per sequence call with wall time profiling " + to_string(t_on) ) ;
+    Geant4ActionProfile* prof = actors.m_v.front()->profile() ;
+    test( prof->calls , uint64_t(7 * num_calls / 10) , " wall time calls counted " ) ;
+    test( histogram_sum( prof->histogram ) , size_t(prof->calls) , " wall time histogram entries " ) ;
+    test( histogram_sum( prof->cpuHistogram ) , size_t(0) , " no CPU histogram at level 1 " ) ;
+
+    // CPU time statistics
+    Geant4ActionProfiler::enable( 2 ) ;
+    Geant4ActionProfiler::reset() ;
+    for( size_t i = 0; i < 1000; ++i ) actors( pmf, 1 ) ;
+    test( histogram_sum( prof->cpuHistogram ) , size_t(1000) , " CPU time histogram entries " ) ;
+    test( prof->maxCpu <= prof->cpu , " maximal CPU time per call " ) ;
+
+    // a shared action gets one record per calling thread
+    Geant4ActionProfiler::reset() ;
+    Geant4ActionProfile* thread_prof[2] = { nullptr, nullptr } ;
+    auto worker = [&actors, pmf, &thread_prof] ( int which, size_t num ) {
+      for( size_t i = 0; i < num; ++i ) actors( pmf, 0 ) ;
+      thread_prof[which] = actors.m_v.front()->profile() ;
+    } ;
+    thread t0( worker, 0, 1000 ), t1( worker, 1, 2000 ) ;
+    t0.join() ;
+    t1.join() ;
+    test( thread_prof[0] != thread_prof[1] && thread_prof[0] != prof , " one record per thread " ) ;
+    test( thread_prof[0]->calls , uint64_t(1000) , " calls of the first thread " ) ;
+    test( thread_prof[1]->calls , uint64_t(2000) , " calls of the second thread " ) ;
+    test( thread_prof[0]->thread != thread_prof[1]->thread , " thread identifiers of the records " ) ;
+
+    // JSON report with the CPU histograms
+    const string report = "test_Geant4ActionProfiler.json" ;
+    test( Geant4ActionProfiler::writeJSON( report ) , " write JSON report " ) ;
+    ifstream in( report ) ;
+    stringstream content ;
+    content << in.rdbuf() ;
+    test( content.str().find( "\"cpu_histogram\"" ) != string::npos , " CPU histogram in the JSON report " ) ;
+    std::remove( report.c_str() ) ;
+
+    // records of deleted actions are not reused by new actions at the same address
+    Geant4ActionProfiler::enable( 0 ) ;
+    for( auto* o : actors ) o->release() ;
+    actors.clear() ;
+    Geant4ActionProfiler::enable( 1 ) ;
+    CountingAction* action = new CountingAction( "NewAction" ) ;
+    test( action->profile()->name , string("NewAction") , " new record for a new action " ) ;
+    action->release() ;
+    Geant4ActionProfiler::enable( 0 ) ;
+
+    // --------------------------------------------------------------------
+  } catch( exception &e ){
+    //} catch( ... ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
+
+//=============================================================================
@@ -0,0 +1,110 @@
+#include "DD4hep/DDTest.h"
+
+#include "DDG4/Geant4HashTable.h"
+
+#include <exception>
+#include <iostream>
+#include <map>
+#include <random>
+
+using namespace std ;
+using namespace dd4hep ;
+using namespace dd4hep::sim ;
+
+// this should be the first line in your test
+static DDTest test( "Geant4HashTable" ) ;
+//=============================================================================
+
+int main(int /* argc */, char** /* argv */ ){
+
+  test.log( "test the flat hash table of the Geant4 path lookup" );
+
+  try{
+
+    // ----- write your tests in here -------------------------------------
+
+    Geant4HashTable<unsigned long long> table ;
+    std::map<uint64_t, unsigned long long> reference ;
+    std::mt19937_64 engine( 12345 ) ;
+
+    test( table.find( 1 ) == nullptr , " lookup in empty table " ) ;
+
+    // random keys including the special key 0 and duplicates
+    table[0]   = 42 ;
+    reference[0] = 42 ;
+    for( int i = 0; i < 10000; ++i ){
+      uint64_t key = engine() ;
+      if( i % 10 == 0 ) key = key % 100 + 1 ; // force some duplicates
+      table[key] = i ;
+      reference[key] = i ;
+    }
+    test( table.size() , reference.size() , " number of entries " ) ;
+
+    auto compare = [&table, &reference] ()  {
+      std::size_t num_bad = 0 ;
+      for( const auto& [key, value] : reference ){
+        const auto* found = table.find( key ) ;
+        if( !found || *found != value ) ++num_bad ;
+      }
+      return num_bad ;
+    } ;
+    test( compare() , std::size_t(0) , " all keys found with the correct value " ) ;
+    test( table.insert( 0, 1 ) == false , " insert of existing key 0 refused " ) ;
+    test( *table.find( 0 ) , 42ULL , " value of key 0 unchanged " ) ;
+
+    std::size_t visited = 0 ;
+    table.for_each( [&visited, &reference] ( uint64_t key, unsigned long long value )  {
+        auto i = reference.find( key ) ;
+        if( i != reference.end() && i->second == value ) ++visited ;
+      } ) ;
+    test( visited , reference.size() , " for_each visits every entry once " ) ;
+
+    // freeze: shrink and keep content
+    std::size_t cap = table.capacity() ;
+    table.freeze() ;
+    test( table.frozen() , " table frozen " ) ;
+    test( table.capacity() <= cap , " frozen table not larger than before " ) ;
+    test( 4 * (table.size() - 1) < 3 * table.capacity() , " frozen load factor below 3/4 " ) ;
+    test( compare() , std::size_t(0) , " all keys found after freeze " ) ;
+
+    std::size_t num_missing = 0 ;
+    for( int i = 0; i < 10000; ++i ){
+      uint64_t key = engine() | (1ULL << 63) ;
+      if( reference.find( key ) == reference.end() && table.find( key ) == nullptr ) ++num_missing ;
+    }
+    test( num_missing , std::size_t(10000) , " unknown keys not found " ) ;
+
+    bool thrown = false ;
+    try  {
+      table[1234567] = 1 ;
+    }
+    catch( const std::exception& ) {
+      thrown = true ;
+    }
+    test( thrown , " insertion into frozen table refused " ) ;
+
+    // reset keeps the memory, clear releases it
+    table.reset() ;
+    test( table.empty() && !table.frozen() , " reset table empty and writable " ) ;
+    test( table.find( 0 ) == nullptr , " key 0 removed by reset " ) ;
+    // the slots of the reused keys still hold the old values: new entries must be default
+    std::size_t num_stale = 0 ;
+    for( const auto& [key, value] : reference ){
+      if( key != 0 && value != 0 && table[key] != 0 ) ++num_stale ;
+    }
+    test( num_stale , std::size_t(0) , " default entries created after reset " ) ;
+    table.clear() ;
+    test( table.capacity() , std::size_t(0) , " clear releases the slots " ) ;
+
+    // --------------------------------------------------------------------
+  } catch( exception &e ){
+    //} catch( ... ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
+
+//=============================================================================
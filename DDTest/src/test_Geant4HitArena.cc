@@ -0,0 +1,110 @@
+#include "DD4hep/DDTest.h"
+
+#include "DDG4/Geant4Data.h"
+
+#include <exception>
+#include <iostream>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace std ;
+using namespace dd4hep ;
+using namespace dd4hep::sim ;
+
+// this should be the first line in your test
+static DDTest test( "Geant4HitArena" ) ;
+//=============================================================================
+
+namespace {
+  /// Create a number of tracker and calorimeter hits
+  vector<Geant4HitData*> create_hits( size_t num )  {
+    vector<Geant4HitData*> hits ;
+    for( size_t i = 0; i < num; ++i ){
+      if( i % 2 == 0 ) hits.push_back( new Geant4Tracker::Hit() ) ;
+      else             hits.push_back( new Geant4Calorimeter::Hit() ) ;
+      hits.back()->cellID = i ;
+    }
+    return hits ;
+  }
+  /// Delete hits and return the number of hits with the expected content
+  size_t delete_hits( vector<Geant4HitData*>& hits )  {
+    size_t num_good = 0 ;
+    for( size_t i = 0; i < hits.size(); ++i ){
+      if( hits[i]->cellID == (long long int)i ) ++num_good ;
+      delete hits[i] ;
+    }
+    hits.clear() ;
+    return num_good ;
+  }
+}
+
+int main(int /* argc */, char** /* argv */ ){
+
+  test.log( "test the thread local hit arena of the DDG4 hits" );
+
+  try{
+
+    // ----- write your tests in here -------------------------------------
+
+    const size_t num_hits = 10000 ;  // several arena blocks
+
+    // hits of a closed event arena are reused in bulk by the next event
+    vector<Geant4HitData*> hits = create_hits( num_hits ) ;
+    Geant4HitData* first = hits.front() ;
+    test( delete_hits( hits ) , num_hits , " hit content of the first event " ) ;
+    Geant4HitArena::endEvent() ;
+    hits = create_hits( num_hits ) ;
+    test( hits.front() == first , " arena memory reused by the next event " ) ;
+
+    // hits released by a different thread while the owner is alive
+    first = hits.front() ;
+    Geant4HitArena::endEvent() ;
+    size_t num_good = 0 ;
+    thread( [&hits, &num_good] () { num_good = delete_hits( hits ) ; } ).join() ;
+    test( num_good , num_hits , " hits deleted by a foreign thread " ) ;
+    hits = create_hits( 10 ) ;
+    test( hits.front() == first , " arena reused after foreign deletion " ) ;
+    test( delete_hits( hits ) , size_t(10) , " hit content after foreign deletion " ) ;
+    Geant4HitArena::endEvent() ;
+
+    // hits outliving the thread which created them
+    thread( [&hits, num_hits] () { hits = create_hits( num_hits ) ; Geant4HitArena::endEvent() ; } ).join() ;
+    test( delete_hits( hits ) , num_hits , " hits deleted after the owner thread exited " ) ;
+
+    // a long-lived hit keeps only its own block: the other blocks are reused by the next event
+    hits = create_hits( num_hits ) ;
+    set<Geant4HitData*> previous( hits.begin(), hits.end() ) ;
+    Geant4HitData* survivor = hits.front() ;
+    hits.erase( hits.begin() ) ;
+    for( auto* h : hits ) delete h ;
+    hits.clear() ;
+    Geant4HitArena::endEvent() ;
+    hits = create_hits( num_hits ) ;
+    size_t num_reused = 0 ;
+    for( auto* h : hits ) if( previous.count( h ) ) ++num_reused ;
+    test( 10 * num_reused > 9 * num_hits , " blocks without live hits reused by the next event " ) ;
+    test( delete_hits( hits ) , num_hits , " hit content next to a long-lived hit " ) ;
+    Geant4HitArena::endEvent() ;
+    test( survivor->cellID , 0LL , " long-lived hit content " ) ;
+    delete survivor ;
+
+    // hits too big for an arena block use the heap
+    struct BigHit : public Geant4Tracker::Hit  {  char data[128*1024] ;  } ;
+    Geant4Tracker::Hit* big = new BigHit() ;
+    big->cellID = 42 ;
+    test( big->cellID , 42LL , " big hit content " ) ;
+    delete big ;
+
+    // --------------------------------------------------------------------
+  } catch( exception &e ){
+    //} catch( ... ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
+
+//=============================================================================
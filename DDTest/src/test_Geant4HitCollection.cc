@@ -0,0 +1,100 @@
+#include "DD4hep/DDTest.h"
+
+#include "DDG4/Geant4Data.h"
+#include "DDG4/Geant4HitCollection.h"
+
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace std ;
+using namespace dd4hep ;
+using namespace dd4hep::sim ;
+
+// this should be the first line in your test
+static DDTest test( "Geant4HitCollection" ) ;
+//=============================================================================
+
+namespace {
+  typedef Geant4Tracker::Hit Hit ;
+
+  /// Fill a collection with keyed hits. The key of every hit is its cell identifier
+  unique_ptr<Geant4HitCollection> fill( VolumeID first, size_t num )  {
+    auto coll = make_unique<Geant4HitCollection>( "det", "coll", nullptr, (Hit*)nullptr ) ;
+    for( size_t i = 0; i < num; ++i ){
+      Hit* hit = new Hit() ;
+      hit->cellID = first + i ;
+      coll->add( hit->cellID, hit ) ;
+    }
+    return coll ;
+  }
+  /// Count the keyed hits found with the correct cell identifier
+  size_t count( Geant4HitCollection& coll, VolumeID first, size_t num )  {
+    size_t num_good = 0 ;
+    for( size_t i = 0; i < num; ++i ){
+      Hit* hit = coll.findByKey<Hit>( first + i ) ;
+      if( hit && hit->cellID == (long long int)(first + i) ) ++num_good ;
+    }
+    return num_good ;
+  }
+}
+
+int main(int /* argc */, char** /* argv */ ){
+
+  test.log( "test the keyed hit lookup of Geant4HitCollection" );
+
+  try{
+
+    // ----- write your tests in here -------------------------------------
+
+    const size_t num_hits = 5000 ;
+    auto coll = fill( 0, num_hits ) ;
+    test( coll->GetSize() , num_hits , " number of hits " ) ;
+    test( count( *coll, 0, num_hits ) , num_hits , " all hits found by key " ) ;
+    test( coll->findByKey<Hit>( num_hits ) == nullptr , " unknown key not found " ) ;
+
+    bool thrown = false ;
+    unique_ptr<Hit> duplicate( new Hit() ) ;
+    try  {
+      coll->add( VolumeID(7), duplicate.get() ) ;
+    }
+    catch( const std::exception& ) {
+      thrown = true ;
+    }
+    test( thrown , " insertion of a duplicated key refused " ) ;
+
+    // released hits are owned by the caller and no longer found
+    vector<Hit*> hits = coll->releaseHits<Hit>() ;
+    test( hits.size() , num_hits , " number of released hits " ) ;
+    test( coll->findByKey<Hit>( 7 ) == nullptr , " released hits not found by key " ) ;
+    for( Hit* h : hits ) delete h ;
+
+    // key maps of deleted collections are reused: no stale keys may survive
+    coll.reset() ;
+    for( int event = 0; event < 100; ++event ){
+      vector<unique_ptr<Geant4HitCollection> > collections ;
+      for( int i = 0; i < 40; ++i )
+        collections.emplace_back( fill( 1000000*(event+1) + 10000*i, 100 ) ) ;
+      size_t num_good = 0, num_stale = 0 ;
+      for( int i = 0; i < 40; ++i ){
+        num_good  += count( *collections[i], 1000000*(event+1) + 10000*i, 100 ) ;
+        num_stale += count( *collections[i], 1000000*event + 10000*i, 100 ) ;
+      }
+      if( num_good != 4000 || num_stale != 0 )
+        test.error( "keyed lookup with recycled key maps" ) ;
+    }
+    test( true , " keyed lookup with recycled key maps " ) ;
+
+    // --------------------------------------------------------------------
+  } catch( exception &e ){
+    //} catch( ... ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
+
+//=============================================================================
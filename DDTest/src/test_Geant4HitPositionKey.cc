@@ -0,0 +1,82 @@
+#include "DD4hep/DDTest.h"
+
+#include "DDG4/Geant4Data.h"
+#include "DDG4/Geant4HitCollection.h"
+
+#include <exception>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace std ;
+using namespace dd4hep ;
+using namespace dd4hep::sim ;
+
+// this should be the first line in your test
+static DDTest test( "Geant4HitPositionKey" ) ;
+//=============================================================================
+
+int main(int /* argc */, char** /* argv */ ){
+
+  test.log( "test the merging of calorimeter hits by hashed position" );
+
+  try{
+
+    // ----- write your tests in here -------------------------------------
+
+    typedef Geant4Calorimeter::Hit Hit ;
+    Geant4HitCollection coll( "det", "coll", nullptr, (Hit*)nullptr ) ;
+    std::mt19937 engine( 4711 ) ;
+    std::uniform_int_distribution<int> cell( -20, 20 ) ;
+
+    // merge deposits at random positions on a coarse grid: many repeated positions
+    size_t num_bad = 0 ;
+    for( int i = 0; i < 20000; ++i ){
+      Position pos( cell(engine), cell(engine), 0.5*cell(engine) ) ;
+      VolumeID key  = hitPositionKey( pos ) ;
+      Hit* hit  = findHitByPosition<Hit>( coll, pos, key ) ;
+      Hit* scan = coll.find<Hit>( PositionCompare<Hit,Position>( pos ) ) ;
+      if( hit != scan ) ++num_bad ;
+      if( !hit ){
+        hit = new Hit( pos ) ;
+        addHitByPosition( coll, hit, key ) ;
+      }
+      hit->energyDeposit += 1.0 ;
+    }
+    test( num_bad , size_t(0) , " keyed lookup identical to the linear scan " ) ;
+
+    double total = 0.0 ;
+    for( size_t i = 0; i < coll.GetSize(); ++i ){
+      Hit* hit = coll.hit( i ) ;
+      total += hit->energyDeposit ;
+    }
+    test( total , 20000.0 , " total deposit of the merged hits " ) ;
+
+    // -0.0 and 0.0 are the same position
+    Position zero( 0.0, 0.0, 0.0 ), neg_zero( -0.0, -0.0, -0.0 ) ;
+    test( hitPositionKey( zero ) , hitPositionKey( neg_zero ) , " same key for -0.0 and 0.0 " ) ;
+
+    // hash collisions: a hit with a colliding key is found by the linear scan
+    Position pos_a( 1000.0, 0.0, 0.0 ), pos_b( 2000.0, 0.0, 0.0 ) ;
+    VolumeID key_a = hitPositionKey( pos_a ) ;
+    Hit* hit_a = new Hit( pos_a ) ;
+    Hit* hit_b = new Hit( pos_b ) ;
+    addHitByPosition( coll, hit_a, key_a ) ;
+    addHitByPosition( coll, hit_b, key_a ) ;
+    test( findHitByPosition<Hit>( coll, pos_a, key_a ) == hit_a , " keyed hit found " ) ;
+    test( findHitByPosition<Hit>( coll, pos_b, key_a ) == hit_b , " colliding hit found " ) ;
+    test( findHitByPosition<Hit>( coll, Position( 3000.0, 0.0, 0.0 ), key_a ) == nullptr ,
+          " unknown position with colliding key not found " ) ;
+
+    // --------------------------------------------------------------------
+  } catch( exception &e ){
+    //} catch( ... ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
+
+//=============================================================================
@@ -0,0 +1,87 @@
+#include "DD4hep/DDTest.h"
+
+#include "DDG4/Geant4StepContext.h"
+#include "DDG4/Geant4SteppingAction.h"
+
+#include <G4DynamicParticle.hh>
+#include <G4Geantino.hh>
+#include <G4Step.hh>
+#include <G4Track.hh>
+
+#include <exception>
+#include <iostream>
+
+using namespace std ;
+using namespace dd4hep ;
+using namespace dd4hep::sim ;
+
+// this should be the first line in your test
+static DDTest test( "Geant4StepContext" ) ;
+//=============================================================================
+
+namespace {
+  /// Create a track with the given identifier which did its first step
+  G4Track* make_track( int id )  {
+    G4DynamicParticle* particle = new G4DynamicParticle( G4Geantino::Definition(), G4ThreeVector( 1, 0, 0 ), 1.0 ) ;
+    G4Track* track = new G4Track( particle, 0.0, G4ThreeVector() ) ;
+    track->SetTrackID( id ) ;
+    track->IncrementCurrentStepNumber() ;
+    return track ;
+  }
+
+  /// Set the pre- and post-step position of the step
+  void set_positions( G4Step& step, double pre, double post )  {
+    step.GetPreStepPoint()->SetPosition( G4ThreeVector( pre, 0, 0 ) ) ;
+    step.GetPostStepPoint()->SetPosition( G4ThreeVector( post, 0, 0 ) ) ;
+  }
+}
+
+int main(int /* argc */, char** /* argv */ ){
+
+  test.log( "test the invalidation of the step context" );
+
+  try{
+
+    // ----- write your tests in here -------------------------------------
+
+    G4Step step ;
+    G4Track* track = make_track( 1 ) ;
+    step.SetTrack( track ) ;
+    set_positions( step, 0.0, 2.0 ) ;
+    test( Geant4StepContext::get( &step ).midpointG4().x() , 1.0 , " midpoint of the first step " ) ;
+
+    set_positions( step, 0.0, 4.0 ) ;
+    test( Geant4StepContext::get( &step ).midpointG4().x() , 1.0 , " midpoint reused within the same step " ) ;
+
+    // Geant4 reuses the memory of deleted tracks: the new track has the same address and step number
+    const G4Track* old_track = track ;
+    delete track ;
+    track = make_track( 2 ) ;
+    step.SetTrack( track ) ;
+    test( track == old_track , " memory of the deleted track reused " ) ;
+    test( Geant4StepContext::get( &step ).midpointG4().x() , 2.0 , " new track with reused memory is a new step " ) ;
+
+    // the stepping action sequence invalidates the context after the last action of the step
+    Geant4SteppingActionSequence* sequence = new Geant4SteppingActionSequence( nullptr, "StepSeq" ) ;
+    (*sequence)( &step, nullptr ) ;
+    test( Geant4StepContext::instance().step() == nullptr , " context invalidated by the stepping sequence " ) ;
+    set_positions( step, 0.0, 6.0 ) ;
+    test( Geant4StepContext::get( &step ).midpointG4().x() , 3.0 , " midpoint recomputed after the stepping sequence " ) ;
+    sequence->release() ;
+
+    Geant4StepContext::instance().reset() ;
+    test( Geant4StepContext::instance().step() == nullptr , " context invalidated by reset " ) ;
+    delete track ;
+
+    // --------------------------------------------------------------------
+  } catch( exception &e ){
+    //} catch( ... ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
+
+//=============================================================================
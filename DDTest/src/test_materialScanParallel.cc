@@ -0,0 +1,89 @@
+#include "DD4hep/DDTest.h"
+
+#include "DD4hep/Detector.h"
+#include "DDRec/MaterialManager.h"
+#include "DDRec/MaterialScanParallel.h"
+
+#include <exception>
+#include <iostream>
+#include <cmath>
+
+using namespace std ;
+using namespace dd4hep ;
+using namespace dd4hep::rec ;
+
+// this should be the first line in your test
+static DDTest test( "materialScanParallel" ) ;
+//=============================================================================
+
+int main(int argc, char** argv ){
+
+  test.log( "compare the parallel material scan with the sequential MaterialManager scan" );
+
+  if( argc < 2 ) {
+    std::cout << " usage:  test_materialScanParallel compact.xml " << std::endl ;
+    exit(1) ;
+  }
+
+  try{
+
+    // ----- write your tests in here -------------------------------------
+
+    Detector& description = Detector::getInstance();
+    description.fromCompact( argv[1] );
+
+    const double eps = MaterialManager::epsilon ;
+    MaterialScanParallel::Binning binning ;
+    binning.nu = 12 ; binning.umin = -3. ; binning.umax = 3. ;
+    binning.nv =  6 ; binning.vmin = -M_PI ; binning.vmax = M_PI ;
+
+    MaterialScanParallel scan( description ) ;
+    scan.setNumThreads( 4 ) ;
+    scan.setBinning( binning ) ;
+
+    auto rays = scan.etaPhiRays( Vector3D(0.,0.,0.), 150.*dd4hep::cm, 200.*dd4hep::cm ) ;
+    scan.scan( rays, eps ) ;
+
+    test( rays.size() , binning.size() , " one ray per bin " ) ;
+    test( description.manager().GetMaxThreads() < 4 , " number of navigator threads restored after the scan " ) ;
+
+    // sequential reference: one ray per bin, hence the bin content equals the ray sum
+    MaterialManager matMgr( description.world().volume() ) ;
+    int ndiff = 0 ;
+    for( const auto& ray : rays ){
+      long bin = binning.index( ray.u, ray.v ) ;
+      const MaterialVec& materials = matMgr.materialsBetween( ray.start, ray.end, eps ) ;
+      double x0 = 0., lambda = 0. ;
+      for( const auto& m : materials ){
+        x0     += m.second / m.first.radLength() ;
+        lambda += m.second / m.first.intLength() ;
+      }
+      double px0     = scan.total().x0[bin] ;
+      double plambda = scan.total().lambda[bin] ;
+      if( std::abs( px0 - x0 ) > 1e-9 * std::max( 1., x0 ) ||
+          std::abs( plambda - lambda ) > 1e-9 * std::max( 1., lambda ) ){
+        std::cout << " ray (" << ray.u << "," << ray.v << ") sequential x0: " << x0 << " lambda: " << lambda
+                  << " parallel x0: " << px0 << " lambda: " << plambda << std::endl ;
+        ++ndiff ;
+      }
+    }
+    test( ndiff , 0 , " parallel and sequential scans agree for all rays " ) ;
+
+    // a second scan with a different number of threads gives identical results
+    std::vector<double> first = scan.total().x0 ;
+    scan.setNumThreads( 1 ) ;
+    scan.scan( rays, eps ) ;
+    test( first == scan.total().x0 , " results independent of the number of threads " ) ;
+
+    // --------------------------------------------------------------------
+  } catch( exception &e ){
+    //} catch( ... ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
+
+//=============================================================================
@@ -23,6 +23,7 @@
 #include <DD4hep/Printout.h>
 #include <DD4hep/Detector.h>
 #include <DDRec/MaterialManager.h>
+#include <DDRec/MaterialScanParallel.h>
 
 #include <TFile.h>
 #include <TH1F.h>
@@ -107,6 +108,7 @@ int main_wrapper(int argc, char** argv)   {
   double thetaMax = 90. ;
   double etaMin = 0. ;
   double etaMax = -1. ;
+  int nthreads = 0 ;
   std::string outFileName("material_budget.root") ;
   std::vector<SDetHelper> subdets ;
     
@@ -138,6 +140,9 @@ int main_wrapper(int argc, char** argv)   {
     else if( token == "etaMax" ){
       iss >> etaMax ;
     }
+    else if( token == "threads" ){
+      iss >> nthreads ;
+    }
     else if( token == "rootfile" ){
       iss >> outFileName ;
     }
@@ -215,26 +220,56 @@ int main_wrapper(int argc, char** argv)   {
     ::exit(EINVAL);
   }
 
+  // Multi-threaded scan: all directions of one subdetector are scanned in parallel
+  std::vector<MaterialScanParallel::Budget> budgets ;
+  if( nthreads > 0 ){
+    MaterialScanParallel parallel( description ) ;
+    MaterialScanParallel::Binning binning ;
+    binning.nu   = nbins ;
+    binning.umin = 0. ;
+    binning.umax = nbins ;
+    parallel.setBinning( binning ) ;
+    parallel.setNumThreads( nthreads ) ;
+    for( auto& det : subdets )  {
+      std::vector<MaterialScanParallel::Ray> rays ;
+      for(int i=0 ; i< nbins ;++i){
+        double theta = ( etaMax > 0. ?  2. * atan ( exp ( - ( etaMin + (0.5+i)*dEta) ) ) : ( thetaMin + (0.5+i)*dTheta ) ) ;
+        rays.emplace_back( MaterialScanParallel::Ray{ pointOnCylinder( theta, det.r0 , det.z0 , phi0 ),
+                                                      pointOnCylinder( theta, det.r1 , det.z1 , phi0 ),
+                                                      0.5+i, 0.5 } ) ;
+      }
+      parallel.scan( rays ) ;
+      budgets.emplace_back( parallel.total() ) ;
+    }
+  }
+
   for(int i=0 ; i< nbins ;++i){
     double theta = ( etaMax > 0. ?  2. * atan ( exp ( - ( etaMin + (0.5+i)*dEta) ) ) : ( thetaMin + (0.5+i)*dTheta ) ) ;
     std::stringstream paramLine;
 
     paramLine << std::scientific << theta << " " ;
-    for( auto& det : subdets )  {
-      Vector3D p0 = pointOnCylinder( theta, det.r0 , det.z0 , phi0  ) ;// double theta, double r, double z, double phi)
-      Vector3D p1 = pointOnCylinder( theta, det.r1 , det.z1 , phi0  ) ;// double theta, double r, double z, double phi)
-      const MaterialVec& materials = matMgr.materialsBetween(p0, p1);
+    for( std::size_t idet = 0 ; idet < subdets.size() ; ++idet )  {
+      auto& det = subdets[idet] ;
       double sum_x0(0.), sum_lambda(0.);
       // double path_length(0.);
 
-      for( auto amat : materials )  {
-        TGeoMaterial* mat =  amat.first->GetMaterial();
-        double length = amat.second;
-        double nx0 = length / mat->GetRadLen();
-        sum_x0 += nx0;
-        double nLambda = length / mat->GetIntLen();
-        sum_lambda += nLambda;
-        // path_length += length;
+      if( !budgets.empty() ){
+        sum_x0     = budgets[idet].x0[i] ;
+        sum_lambda = budgets[idet].lambda[i] ;
+      }
+      else {
+        Vector3D p0 = pointOnCylinder( theta, det.r0 , det.z0 , phi0  ) ;// double theta, double r, double z, double phi)
+        Vector3D p1 = pointOnCylinder( theta, det.r1 , det.z1 , phi0  ) ;// double theta, double r, double z, double phi)
+        const MaterialVec& materials = matMgr.materialsBetween(p0, p1);
+        for( auto amat : materials )  {
+          TGeoMaterial* mat =  amat.first->GetMaterial();
+          double length = amat.second;
+          double nx0 = length / mat->GetRadLen();
+          sum_x0 += nx0;
+          double nLambda = length / mat->GetIntLen();
+          sum_lambda += nLambda;
+          // path_length += length;
+        }
       }
 
       double binX = ( etaMax > 0. ? (etaMin + (0.5+i)*dEta) : -theta/M_PI*180. ) ;
@@ -269,6 +304,9 @@ void dumpExampleSteering(){
   std::cout << "# phi direction in deg (default: 90./y-axis)" << std::endl ;
   std::cout << "phi 90." << std::endl ;
   std::cout <<  std::endl ;
+  std::cout << "# number of worker threads for a parallel scan (default 0: sequential scan)" << std::endl ;
+  std::cout << "# threads 8" << std::endl ;
+  std::cout <<  std::endl ;
   std::cout << "# names and subdetector ranges given in [rmin,zmin,rmax,zmax] - e.g. for ILD_l5_vo2  (run dumpdetector -d to get numbers... ) " << std::endl ;
   std::cout <<  std::endl ;
   std::cout << "subdet vxd    0. 0. 6.549392e+00 1.450000e+01" << std::endl ;
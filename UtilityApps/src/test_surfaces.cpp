@@ -16,6 +16,8 @@
 #include "DDRec/DetectorSurfaces.h"
 #include "DDRec/SurfaceManager.h"
 #include "DDRec/SurfaceHelper.h"
+#include "DDRec/SurfaceIndex.h"
+#include "DDRec/SurfaceBatch.h"
 #include "DD4hep/DDTest.h"
 
 #include "DD4hep/DD4hepUnits.h"
@@ -28,6 +30,10 @@
 #include "UTIL/ILDConf.h"
 
 #include <map>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <set>
 #include <sstream>
 
 using namespace std ;
@@ -83,6 +89,13 @@ int main_wrapper(int argc, char** argv ){
 
 #endif
 
+  // spatial index over all surfaces
+  SurfaceIndex surfIndex( surfMap ) ;
+
+  // hit points and surfaces for the batch evaluation benchmark
+  std::vector<double> hitX, hitY, hitZ ;
+  std::set<const ISurface*> hitSurfaces ;
+
   //---------------------------------------------------------------------
   //    open lcio file with SimTrackerHits
   //---------------------------------------------------------------------
@@ -159,6 +172,18 @@ int main_wrapper(int argc, char** argv ){
           // ====== test that hit points are inside their surface ================================
 	  
           test( isInside , true , sst.str() ) ;
+
+          hitX.emplace_back( point.x() ) ;
+          hitY.emplace_back( point.y() ) ;
+          hitZ.emplace_back( point.z() ) ;
+          hitSurfaces.insert( surf ) ;
+
+          // ====== test that the spatial index finds the surface of the hit ================================
+
+          std::vector<ISurface*> found = surfIndex.surfacesAt( point ) ;
+          sst.str("") ;
+          sst << " point " << point << " is found on surface by the surface index " ;
+          test( std::find( found.begin(), found.end(), surf ) != found.end() , isInside , sst.str() ) ;
 	  
           if( ! isInside ) {
 
@@ -212,6 +237,50 @@ int main_wrapper(int argc, char** argv ){
     
     
   }
+
+  // ====== compare batched surface evaluation with the ISurface interface and time both ======
+
+  const std::size_t maxSurfaces = 100 ;
+  std::vector<const ISurface*> batchSurfaces( hitSurfaces.begin(), hitSurfaces.end() ) ;
+  if( batchSurfaces.size() > maxSurfaces ) batchSurfaces.resize( maxSurfaces ) ;
+
+  SurfaceBatch batch( batchSurfaces ) ;
+  PointBlock block { hitX.data(), hitY.data(), hitZ.data(), hitX.size() } ;
+  std::vector<double>        dist( block.size ),   batchDist( block.size ) ;
+  std::vector<unsigned char> inside( block.size ), batchInside( block.size ) ;
+  double tScalar = 0., tBatch = 0., maxDiff = 0. ;
+  std::size_t nMismatch = 0 ;
+
+  for( std::size_t is = 0 ; is < batch.size() ; ++is ){
+    const ISurface* surf = batch.surface( is ) ;
+
+    auto t0 = std::chrono::steady_clock::now() ;
+    for( std::size_t i = 0 ; i < block.size ; ++i ){
+      Vector3D point( hitX[i], hitY[i], hitZ[i] ) ;
+      dist[i]   = surf->distance( point ) ;
+      inside[i] = surf->insideBounds( point ) ;
+    }
+    auto t1 = std::chrono::steady_clock::now() ;
+    batch.distance( is, block, batchDist.data() ) ;
+    batch.insideBounds( is, block, batchInside.data() ) ;
+    auto t2 = std::chrono::steady_clock::now() ;
+
+    tScalar += std::chrono::duration<double>( t1 - t0 ).count() ;
+    tBatch  += std::chrono::duration<double>( t2 - t1 ).count() ;
+    for( std::size_t i = 0 ; i < block.size ; ++i ){
+      maxDiff = std::max( maxDiff, std::abs( dist[i] - batchDist[i] ) ) ;
+      // points within rounding distance of the tolerance may legitimately differ
+      if( inside[i] != batchInside[i] && std::abs( std::abs( dist[i] ) - 1.e-4 ) > 1.e-9 )
+        ++nMismatch ;
+    }
+  }
+
+  std::cout << "  -- batch evaluation of " << batch.size() << " surfaces x " << block.size << " points: "
+            << " ISurface: " << tScalar << " s  SurfaceBatch: " << tBatch << " s" << std::endl ;
+
+  test( maxDiff < 1.e-9 , true , " batch distance agrees with ISurface::distance " ) ;
+  test( nMismatch , std::size_t(0) , " batch insideBounds agrees with ISurface::insideBounds " ) ;
+
   return 0;
 }
 
@@ -0,0 +1,127 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+#
+import os
+import sys
+import logging
+import DDG4
+from DDG4 import OutputLevel as Output
+from g4units import GeV, MeV
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+#
+#
+"""
+
+   dd4hep simulation example setup using the python configuration
+
+   Mode 'write': record the showers of single electrons in the silicon
+                 region with the full simulation into a shower library.
+   Mode 'read':  replace the showers in the silicon region by the showers
+                 of the library written before.
+
+"""
+
+
+def run():
+  args = DDG4.CommandLine()
+  mode = args.mode if args.mode else 'write'
+  library = args.library if args.library else 'SiliconBlock_ShowerLibrary.shlb'
+  if args.help or mode not in ('write', 'read'):
+    logger.info("""
+         python <dir>/SiliconBlockShowerLibrary.py -option [-option]
+              -mode     <write|read>     Record the shower library or use it (default: write)
+              -library  <file name>      Shower library file (default: SiliconBlock_ShowerLibrary.shlb)
+              -events   <number>         Number of events to be simulated
+              -batch                     Run in batch mode
+    """)
+    sys.exit(0)
+
+  kernel = DDG4.Kernel()
+  install_dir = os.environ['DD4hepExamplesINSTALL']
+  kernel.loadGeometry(str("file:" + install_dir + "/examples/ClientTests/compact/SiliconBlock.xml"))
+
+  DDG4.importConstants(kernel.detectorDescription(), debug=False)
+  geant4 = DDG4.Geant4(kernel, tracker='Geant4TrackerAction', calo='Geant4CalorimeterAction')
+  geant4.printDetectors()
+  # Configure UI
+  if args.macro:
+    ui = geant4.setupCshUI(macro=args.macro)
+  else:
+    ui = geant4.setupCshUI()
+  if args.batch:
+    ui.Commands = ['/run/beamOn ' + str(args.events if args.events else 10), '/ddg4/UI/terminate']
+
+  # Configure field
+  geant4.setupTrackingField(prt=True)
+
+  # Configure G4 geometry setup
+  seq, act = geant4.addDetectorConstruction('Geant4DetectorGeometryConstruction/ConstructGeo')
+
+  # Apply sensitive detectors
+  sensitives = DDG4.DetectorConstruction(kernel, str('Geant4DetectorSensitivesConstruction/ConstructSD'))
+  sensitives.enableUI()
+  seq.adopt(sensitives)
+
+  if mode == 'write':
+    # Record the showers of the full simulation
+    writer = DDG4.SteppingAction(kernel, 'Geant4ShowerLibraryWriter/ShowerWriter')
+    writer.Output = library
+    writer.RegionName = 'SiRegion'
+    writer.Particles = ['e-']
+    writer.EnergyBins = [0.1 * GeV, 10 * GeV]
+    writer.EtaBins = [0.0, 10.0]
+    writer.Materials = ['Silicon']
+    writer.enableUI()
+    kernel.steppingAction().adopt(writer)
+  else:
+    # Replace the showers by the showers of the library
+    model = DDG4.DetectorConstruction(kernel, str('Geant4ShowerLibraryModel/ShowerModel'))
+    model.RegionName = 'SiRegion'
+    model.LibraryFile = library
+    model.MaxEnergy = 10 * GeV
+    model.Enable = True
+    model.enableUI()
+    seq.adopt(model)
+    # Dump the hits created from the library showers
+    dump = DDG4.EventAction(kernel, 'Geant4HitDumpAction/HitDump')
+    kernel.eventAction().adopt(dump)
+
+  # Setup particle gun
+  gun = geant4.setupGun("Gun", particle='e-', energy=1 * GeV, multiplicity=1,
+                        isotrop=False, direction=(1.0, 0.0, 0.0))
+  gun.OutputLevel = Output.INFO
+
+  # And handle the simulation particles.
+  part = DDG4.GeneratorAction(kernel, "Geant4ParticleHandler/ParticleHandler")
+  kernel.generatorAction().adopt(part)
+  part.MinimalKineticEnergy = 100 * MeV
+  part.enableUI()
+
+  geant4.setupCalorimeter('SiliconBlockUpper')
+  geant4.setupCalorimeter('SiliconBlockDown')
+
+  # Now build the physics list:
+  phys = geant4.setupPhysics('FTFP_BERT')
+  if mode == 'read':
+    ph = DDG4.PhysicsList(kernel, str('Geant4FastPhysics/FastPhysicsList'))
+    ph.EnabledParticles = ['e+', 'e-', 'gamma']
+    ph.enableUI()
+    phys.adopt(ph)
+  phys.dump()
+
+  geant4.execute()
+
+
+if __name__ == "__main__":
+  run()
@@ -45,7 +45,19 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
   xml_comp_t x_param = x_det.child(_U(param));
   Box        box     (x_param.x(), x_param.y(), x_param.z());
   Volume     box_vol (x_det.nameStr()+"_param", box, description.material(x_param.materialStr()));
+  Volume     sens_vol = box_vol;
   PlacedVolume pv;
+  // Optionally place the cells one by one instead of using a parameterisation
+  bool explicit_placements = x_param.hasAttr(_Unicode(explicit)) && x_param.attr<bool>(_Unicode(explicit));
+  bool volume_ids = sens.isValid();
+
+  // Optionally the sensitive volume is a daughter of the parameterised cell
+  if ( x_param.hasAttr(_Unicode(nested)) && x_param.attr<bool>(_Unicode(nested)) )   {
+    Box sens_box(x_param.x()/2e0, x_param.y()/2e0, x_param.z()/2e0);
+    sens_vol = Volume(x_det.nameStr()+"_sensor", sens_box, description.material(x_param.materialStr()));
+    sens_vol.setAttributes(description,x_param.regionStr(),x_param.limitsStr(),x_param.visStr());
+    box_vol.placeVolume(sens_vol);
+  }
 
   if ( x_param.hasChild(_U(replicate)) )   {
     xml_dim_t x_repl = x_param.child(_U(replicate));
@@ -84,7 +96,24 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
       trafo3 = get_trafo(x_dim_z);
     }
 
-    if ( x_trafo.hasChild(_U(dim_y)) && x_trafo.hasChild(_U(dim_z)) )    {
+    if ( explicit_placements )   {
+      std::size_t count_1 = x_dim_x.repeat();
+      std::size_t count_2 = x_trafo.hasChild(_U(dim_y)) ? x_dim_y.repeat() : 1;
+      std::size_t count_3 = x_trafo.hasChild(_U(dim_z)) ? x_dim_z.repeat() : 1;
+      Transform3D tr3(start);
+      for( std::size_t k = 0, copy = 0; k < count_3; ++k, tr3 *= trafo3 )   {
+        Transform3D tr2(tr3);
+        for( std::size_t j = 0; j < count_2; ++j, tr2 *= trafo2 )   {
+          Transform3D tr1(tr2);
+          for( std::size_t i = 0; i < count_1; ++i, ++copy, tr1 *= trafo1 )   {
+            pv = envelope_vol.placeVolume(box_vol, tr1);
+            if ( volume_ids ) pv.addPhysVolID("volume", copy);
+          }
+        }
+      }
+      volume_ids = false;
+    }
+    else if ( x_trafo.hasChild(_U(dim_y)) && x_trafo.hasChild(_U(dim_z)) )    {
       pv = envelope_vol.paramVolume3D(start, box_vol, 
                                       x_dim_x.repeat(), trafo1,
                                       x_dim_y.repeat(), trafo2,
@@ -101,9 +130,11 @@ static Ref_t create_detector(Detector& description, xml_h e, SensitiveDetector s
   }
   if ( sens.isValid() )   {
     sens.setType("calorimeter");
+  }
+  if ( volume_ids )   {
     pv.addPhysVolID("volume", 0);
   }
-  box_vol.setSensitiveDetector(sens);
+  sens_vol.setSensitiveDetector(sens);
   box_vol.setAttributes(description,x_param.regionStr(),x_param.limitsStr(),x_param.visStr());
 
   det.setAttributes(description,envelope_vol,x_det.regionStr(),x_det.limitsStr(),x_det.visStr());
@@ -0,0 +1,129 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+import logging
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+#
+#
+"""
+
+   Write EDM4hep output in multi-threaded mode with one output action per
+   worker thread sharing the output stream and read the file back:
+   all events must be present in order and exactly one metadata frame
+   must hold the cell ID encodings of all collections.
+
+"""
+
+
+def setupWorker(geant4, output, writer_thread):
+  import DDG4
+  from g4units import GeV
+  kernel = geant4.kernel()
+  evt_edm4hep = DDG4.EventAction(kernel, 'Geant4Output2EDM4hep/EDM4hepOutput', False)
+  evt_edm4hep.Control = True
+  evt_edm4hep.Output = output
+  evt_edm4hep.WriterThread = writer_thread
+  evt_edm4hep.OrderEvents = True
+  kernel.eventAction().adopt(evt_edm4hep)
+
+  gen = DDG4.GeneratorAction(kernel, "Geant4GeneratorActionInit/GenerationInit")
+  kernel.generatorAction().adopt(gen)
+  gen = DDG4.GeneratorAction(kernel, "Geant4IsotropeGenerator/IsotropPi+")
+  gen.Mask = 1
+  gen.Particle = 'pi+'
+  gen.Energy = 10 * GeV
+  gen.Multiplicity = 3
+  kernel.generatorAction().adopt(gen)
+  gen = DDG4.GeneratorAction(kernel, "Geant4InteractionMerger/InteractionMerger")
+  kernel.generatorAction().adopt(gen)
+  gen = DDG4.GeneratorAction(kernel, "Geant4PrimaryHandler/PrimaryHandler")
+  kernel.generatorAction().adopt(gen)
+  part = DDG4.GeneratorAction(kernel, "Geant4ParticleHandler/ParticleHandler")
+  kernel.generatorAction().adopt(part)
+  return 1
+
+
+def setupMaster(geant4):
+  return 1
+
+
+def setupSensitives(geant4):
+  geant4.setupDetectors()
+  return 1
+
+
+def check(output, num_events):
+  from podio.root_io import Reader
+  reader = Reader(output)
+  events = [frame.get('EventHeader')[0].getEventNumber() for frame in reader.get('events')]
+  num_metadata = len(reader.get('metadata')) if 'metadata' in reader.categories else 0
+  encodings = []
+  if num_metadata:
+    encodings = [k for k in reader.get('metadata')[0].parameters if k.endswith('CellIDEncoding')]
+  logger.info('+++ Read %d events %s, %d metadata frames with %d cell ID encodings',
+              len(events), str(events), num_metadata, len(encodings))
+  if events != list(range(num_events)):
+    logger.error('+++ Event frames missing or out of order')
+    return False
+  if num_metadata != 1 or not encodings:
+    logger.error('+++ Expected exactly one metadata frame with the cell ID encodings')
+    return False
+  return True
+
+
+def run():
+  import os
+  import sys
+  import DDG4
+
+  args = DDG4.CommandLine()
+  install_dir = os.environ['DD4hepExamplesINSTALL'] + "/examples/ClientTests/compact"
+  if args.help or not args.output:
+    logger.info("""
+         python <dir>/TestEDM4hepMT.py -option [-option]
+              -output   <file name>      EDM4hep output file
+              -events   <number>         Number of events to be simulated
+              -threads  <number>         Number of worker threads
+              -writer_thread             Write the frames from a dedicated thread
+    """)
+    sys.exit(0)
+
+  num_events = int(args.events) if args.events else 10
+  kernel = DDG4.Kernel()
+  kernel.loadGeometry(str("file:" + install_dir + os.sep + "MiniTel.xml"))
+  DDG4.importConstants(kernel.detectorDescription(), debug=False)
+
+  kernel.NumberOfThreads = int(args.threads) if args.threads else 3
+  kernel.RunManagerType = 'G4MTRunManager'
+  kernel.NumEvents = num_events
+  geant4 = DDG4.Geant4(kernel, tracker='Geant4TrackerCombineAction', calo='Geant4CalorimeterAction')
+  geant4.setupUI(typ="tcsh", vis=False, macro=None, ui=False)
+  worker_args = (geant4, str(args.output), bool(args.writer_thread))
+  geant4.addUserInitialization(worker=setupWorker, worker_args=worker_args,
+                               master=setupMaster, master_args=(geant4,))
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  seq, act = geant4.addDetectorConstruction("Geant4PythonDetectorConstruction/SetupSD",
+                                            sensitives=setupSensitives, sensitives_args=(geant4,))
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorSensitivesConstruction/ConstructSD")
+  phys = geant4.setupPhysics('QGSP_BERT')
+  phys.dump()
+  geant4.execute()
+
+  if check(str(args.output), num_events):
+    logger.info('+++ Test PASSED')
+  else:
+    logger.error('+++ Test FAILED')
+
+
+if __name__ == "__main__":
+  run()
@@ -0,0 +1,103 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+import logging
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+#
+#
+"""
+
+   Check the filters of the sensitive detector sequences: a step must reach
+   the sensitive actions if and only if every filter accepts it individually.
+   The filters are evaluated as fused chain unless -no_fuse is given.
+
+"""
+
+
+def run():
+  import os
+  import sys
+  import DDG4
+  from DDG4 import OutputLevel as Output
+  from g4units import GeV, MeV, keV
+
+  args = DDG4.CommandLine()
+  install_dir = os.environ['DD4hepExamplesINSTALL'] + "/examples/ClientTests/compact"
+  if args.help:
+    logger.info("""
+         python <dir>/TestFilterChain.py -option [-option]
+              -events   <number>         Number of events to be simulated
+              -no_fuse                   Invoke every filter instead of the fused filter chain
+    """)
+    sys.exit(0)
+
+  kernel = DDG4.Kernel()
+  kernel.loadGeometry(str("file:" + install_dir + os.sep + "MiniTel.xml"))
+  DDG4.importConstants(kernel.detectorDescription(), debug=False)
+  geant4 = DDG4.Geant4(kernel, tracker='TestFilterChainSD', calo='TestFilterChainSD')
+  geant4.setupUI(typ="tcsh", vis=False, macro=None, ui=False)
+
+  # Configure G4 geometry setup
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorSensitivesConstruction/ConstructSD")
+
+  # Global filters: all term types, a duplicated energy cut and one generic filter
+  filters = []
+  f = DDG4.Filter(kernel, 'GeantinoRejectFilter/GeantinoRejector')
+  filters.append(f)
+  f = DDG4.Filter(kernel, 'ParticleRejectFilter/PositronRejector')
+  f.particle = 'e+'
+  filters.append(f)
+  f = DDG4.Filter(kernel, 'ParticleSelectFilter/PionSelector')
+  f.particle = 'pi+'
+  filters.append(f)
+  f = DDG4.Filter(kernel, 'EnergyDepositMinimumCut/EnergyCut1')
+  f.Cut = 5 * keV
+  filters.append(f)
+  f = DDG4.Filter(kernel, 'TestMomentumFilter/MomentumFilter')
+  f.MinMomentum = 500 * MeV
+  filters.append(f)
+  f = DDG4.Filter(kernel, 'EnergyDepositMinimumCut/EnergyCut2')
+  f.Cut = 20 * keV
+  filters.append(f)
+  for f in filters:
+    kernel.registerGlobalFilter(f)
+
+  description = kernel.detectorDescription()
+  for det in description.detectors():
+    name = str(det.first)
+    if description.sensitiveDetector(name).isValid():
+      seq, act = geant4.setupTracker(name)
+      seq.FuseFilters = not args.no_fuse
+      for f in filters:
+        seq.adopt(f)
+
+  # Setup particle gun
+  gun = geant4.setupGun("Gun", particle='pi+', energy=10 * GeV, multiplicity=5, isotrop=True)
+  gun.OutputLevel = Output.INFO
+  kernel.NumEvents = int(args.events) if args.events else 5
+
+  # Instantiate the checking stepping action
+  stepping = DDG4.SteppingAction(kernel, 'TestFilterChainAction/FilterChainCheck')
+  stepping.Filters = [f.name() for f in filters]
+  kernel.steppingAction().add(stepping)
+
+  # Now build the physics list:
+  phys = geant4.setupPhysics('QGSP_BERT')
+  phys.dump()
+  # Start the engine...
+  geant4.execute()
+
+
+if __name__ == "__main__":
+  run()
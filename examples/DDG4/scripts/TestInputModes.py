@@ -0,0 +1,100 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+import logging
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+#
+#
+"""
+
+   Read a HepMC file twice: once with the default sequential reader as reference
+   and once with the read-ahead thread and/or the memory mapped reader.
+   The primary particles of both inputs must be identical for every event.
+
+"""
+
+
+def run():
+  import os
+  import sys
+  import DDG4
+
+  args = DDG4.CommandLine()
+  install_dir = os.environ['DD4hepExamplesINSTALL'] + "/examples/ClientTests/compact"
+  if args.help or not args.input:
+    logger.info("""
+         python <dir>/TestInputModes.py -option [-option]
+              -input      <file name>    HepMC2 ASCII input file
+              -events     <number>       Number of events to be simulated
+              -prefetch   <number>       Number of events decoded ahead by a background thread
+              -memory_map                Read the input file with the memory mapped reader
+              -index_file <file name>    Event index file of the memory mapped reader
+    """)
+    sys.exit(0)
+
+  kernel = DDG4.Kernel()
+  kernel.loadGeometry(str("file:" + install_dir + os.sep + "MiniTel.xml"))
+  DDG4.importConstants(kernel.detectorDescription(), debug=False)
+  geant4 = DDG4.Geant4(kernel, tracker='Geant4TrackerCombineAction', calo='Geant4CalorimeterAction')
+  geant4.setupUI(typ="tcsh", vis=False, macro=None, ui=False)
+
+  # Configure G4 geometry setup
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorSensitivesConstruction/ConstructSD")
+  geant4.setupDetectors()
+  kernel.NumEvents = int(args.events) if args.events else 5
+
+  gen = DDG4.GeneratorAction(kernel, "Geant4GeneratorActionInit/GenerationInit")
+  kernel.generatorAction().adopt(gen)
+  # The reference input: sequential reader without read-ahead
+  ref = DDG4.GeneratorAction(kernel, "Geant4InputAction/ReferenceInput")
+  ref.Input = "Geant4EventReaderHepMC|" + str(args.input)
+  ref.Mask = 1
+  kernel.generatorAction().adopt(ref)
+  # The inputs to be tested. The second one finds the event index written by the first one.
+  masks = [2, 4] if args.index_file else [2]
+  if args.index_file and os.path.exists(str(args.index_file)):
+    os.remove(str(args.index_file))
+  for mask in masks:
+    inp = DDG4.GeneratorAction(kernel, "Geant4InputAction/TestInput%d" % (mask,))
+    inp.Input = "Geant4EventReaderHepMC|" + str(args.input)
+    inp.Mask = mask
+    if args.prefetch:
+      inp.Prefetch = int(args.prefetch)
+    if args.memory_map:
+      params = {'MemoryMap': 'true'}
+      if args.index_file:
+        params['IndexFile'] = str(args.index_file)
+      inp.Parameters = params
+    kernel.generatorAction().adopt(inp)
+
+  # Compare the test inputs with the reference before the interactions are merged
+  cmp = DDG4.GeneratorAction(kernel, "TestInputCompareAction/InputCompare")
+  cmp.Reference = 1
+  cmp.Masks = masks
+  kernel.generatorAction().adopt(cmp)
+
+  gen = DDG4.GeneratorAction(kernel, "Geant4InteractionMerger/InteractionMerger")
+  kernel.generatorAction().adopt(gen)
+  gen = DDG4.GeneratorAction(kernel, "Geant4PrimaryHandler/PrimaryHandler")
+  kernel.generatorAction().adopt(gen)
+
+  # Now build the physics list:
+  phys = geant4.setupPhysics('QGSP_BERT')
+  phys.dump()
+  # Start the engine...
+  geant4.execute()
+
+
+if __name__ == "__main__":
+  run()
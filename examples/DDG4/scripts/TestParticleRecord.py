@@ -0,0 +1,81 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+import logging
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+#
+#
+"""
+
+   Check the consistency of the particle record of the Geant4ParticleHandler
+   and of the track identifiers of the hit contributions for one of the
+   ClientTests geometries.
+
+"""
+
+
+def run():
+  import os
+  import sys
+  import DDG4
+  from DDG4 import OutputLevel as Output
+  from g4units import GeV, MeV
+
+  args = DDG4.CommandLine()
+  install_dir = os.environ['DD4hepExamplesINSTALL'] + "/examples/ClientTests/compact"
+  if args.help or not args.geometry:
+    logger.info("""
+         python <dir>/TestParticleRecord.py -option [-option]
+              -geometry <file name>      Geometry file in """ + install_dir + """
+              -events   <number>         Number of events to be simulated
+    """)
+    sys.exit(0)
+
+  kernel = DDG4.Kernel()
+  kernel.loadGeometry(str("file:" + install_dir + os.sep + args.geometry))
+
+  DDG4.importConstants(kernel.detectorDescription(), debug=False)
+  geant4 = DDG4.Geant4(kernel, tracker='Geant4TrackerCombineAction', calo='Geant4CalorimeterAction')
+  geant4.printDetectors()
+  geant4.setupUI(typ="tcsh", vis=False, macro=None, ui=False)
+
+  # Configure G4 geometry setup
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorSensitivesConstruction/ConstructSD")
+  geant4.setupDetectors()
+
+  # Setup particle gun
+  gun = geant4.setupGun("Gun", particle='pi+', energy=10 * GeV, multiplicity=3, isotrop=True)
+  gun.OutputLevel = Output.INFO
+  kernel.NumEvents = int(args.events) if args.events else 5
+
+  # Handle the simulation particles: drop most secondaries to exercise the recombination
+  part = DDG4.GeneratorAction(kernel, 'Geant4ParticleHandler/ParticleHandler')
+  kernel.generatorAction().adopt(part)
+  part.SaveProcesses = ['Decay']
+  part.MinimalKineticEnergy = 100 * MeV
+  part.KeepAllParticles = False
+
+  # Instantiate the checking event action
+  check = DDG4.EventAction(kernel, 'TestParticleRecordAction/ParticleRecordCheck')
+  kernel.eventAction().add(check)
+
+  # Now build the physics list:
+  phys = geant4.setupPhysics('QGSP_BERT')
+  phys.dump()
+  # Start the engine...
+  geant4.execute()
+
+
+if __name__ == "__main__":
+  run()
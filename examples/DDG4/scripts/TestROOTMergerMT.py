@@ -0,0 +1,144 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+import logging
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+#
+#
+"""
+
+   Write ROOT output in multi-threaded mode with one output action per
+   worker thread merging its buffers into the same file and read the
+   file back: the EVENT tree must hold all events of all workers.
+
+   The sensitive detector of the late collection is inactive in a first
+   run and active in a second run. Its collection appears only after
+   buffers were handed to the merger: every branch must nevertheless
+   have one entry per event.
+
+"""
+
+
+def setupWorker(geant4, output, flush_events):
+  import DDG4
+  from g4units import GeV
+  kernel = geant4.kernel()
+  evt_root = DDG4.EventAction(kernel, 'Geant4Output2ROOT/RootOutput', False)
+  evt_root.Control = True
+  evt_root.Output = output
+  evt_root.BufferMerger = True
+  evt_root.FlushEvents = flush_events
+  kernel.eventAction().adopt(evt_root)
+
+  gen = DDG4.GeneratorAction(kernel, "Geant4GeneratorActionInit/GenerationInit")
+  kernel.generatorAction().adopt(gen)
+  gen = DDG4.GeneratorAction(kernel, "Geant4IsotropeGenerator/IsotropPi+")
+  gen.Mask = 1
+  gen.Particle = 'pi+'
+  gen.Energy = 10 * GeV
+  gen.Multiplicity = 3
+  kernel.generatorAction().adopt(gen)
+  gen = DDG4.GeneratorAction(kernel, "Geant4InteractionMerger/InteractionMerger")
+  kernel.generatorAction().adopt(gen)
+  gen = DDG4.GeneratorAction(kernel, "Geant4PrimaryHandler/PrimaryHandler")
+  kernel.generatorAction().adopt(gen)
+  part = DDG4.GeneratorAction(kernel, "Geant4ParticleHandler/ParticleHandler")
+  kernel.generatorAction().adopt(part)
+  return 1
+
+
+def setupMaster(geant4):
+  return 1
+
+
+def setupSensitives(geant4):
+  geant4.setupDetectors()
+  return 1
+
+
+def check(output, num_events, late_collection):
+  import ROOT
+  fin = ROOT.TFile.Open(output)
+  tree = fin.Get('EVENT') if fin and not fin.IsZombie() else None
+  num_entries = tree.GetEntries() if tree else -1
+  branches = [b for b in tree.GetListOfBranches()] if tree else []
+  logger.info('+++ Read %d events with %d branches from %s', num_entries, len(branches), output)
+  if num_entries != num_events or not branches:
+    logger.error('+++ Expected %d events in the EVENT tree', num_events)
+    return False
+  result = True
+  for b in branches:
+    if b.GetEntries() != num_entries:
+      logger.error('+++ Branch %s has %d entries instead of %d', b.GetName(), b.GetEntries(), num_entries)
+      result = False
+  if not tree.GetBranch(late_collection):
+    logger.error('+++ Branch of the late collection %s is missing', late_collection)
+    result = False
+  return result
+
+
+def run():
+  import os
+  import sys
+  import DDG4
+
+  args = DDG4.CommandLine()
+  install_dir = os.environ['DD4hepExamplesINSTALL'] + "/examples/ClientTests/compact"
+  if args.help or not args.output:
+    logger.info("""
+         python <dir>/TestROOTMergerMT.py -option [-option]
+              -output   <file name>      ROOT output file
+              -events   <number>         Number of events to be simulated
+              -threads  <number>         Number of worker threads
+              -flush    <number>         Number of events per buffer hand-over to the merger
+              -run_manager <type>        Geant4 run manager type (default: G4MTRunManager)
+              -grainsize   <number>      Number of events per task of the task based run managers
+    """)
+    sys.exit(0)
+
+  num_events = int(args.events) if args.events else 10
+  late_detector = 'MyLHCBdetector5'
+  kernel = DDG4.Kernel()
+  kernel.loadGeometry(str("file:" + install_dir + os.sep + "MiniTel.xml"))
+  DDG4.importConstants(kernel.detectorDescription(), debug=False)
+
+  kernel.NumberOfThreads = int(args.threads) if args.threads else 3
+  kernel.RunManagerType = str(args.run_manager) if args.run_manager else 'G4MTRunManager'
+  if args.grainsize:
+    kernel.EventGrainsize = int(args.grainsize)
+  kernel.NumEvents = num_events
+  geant4 = DDG4.Geant4(kernel, tracker='Geant4TrackerCombineAction', calo='Geant4CalorimeterAction')
+  ui = geant4.setupUI(typ="tcsh", vis=False, macro=None, ui=False)
+  ui.Commands = ['/hits/inactivate ' + late_detector,
+                 '/run/beamOn ' + str(num_events // 2),
+                 '/hits/activate ' + late_detector,
+                 '/run/beamOn ' + str(num_events - num_events // 2)]
+  worker_args = (geant4, str(args.output), int(args.flush) if args.flush else 1)
+  geant4.addUserInitialization(worker=setupWorker, worker_args=worker_args,
+                               master=setupMaster, master_args=(geant4,))
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  seq, act = geant4.addDetectorConstruction("Geant4PythonDetectorConstruction/SetupSD",
+                                            sensitives=setupSensitives, sensitives_args=(geant4,))
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorSensitivesConstruction/ConstructSD")
+  phys = geant4.setupPhysics('QGSP_BERT')
+  phys.dump()
+  geant4.execute()
+
+  if check(str(args.output), num_events, late_detector + 'Hits'):
+    logger.info('+++ Test PASSED')
+  else:
+    logger.error('+++ Test FAILED')
+
+
+if __name__ == "__main__":
+  run()
@@ -0,0 +1,64 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+import logging
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+#
+#
+"""
+
+   Convert a geometry with tessellated solids to Geant4 using several
+   threads and compare the Geant4 solids with the ROOT shapes.
+
+"""
+
+
+def run():
+  import os
+  import sys
+  import DDG4
+  from DDG4 import OutputLevel as Output
+
+  args = DDG4.CommandLine()
+  install_dir = os.environ['DD4hepExamplesINSTALL'] + "/examples/ClientTests/compact"
+  geometry = args.geometry if args.geometry else install_dir + os.sep + "Check_Shape_Tessellated.xml"
+  if args.help:
+    logger.info("""
+         python <dir>/TestTessellatedSolids.py -option [-option]
+              -geometry <file name>      Geometry file (default: """ + geometry + """)
+              -threads  <number>         Number of threads for the geometry conversion
+    """)
+    sys.exit(0)
+
+  kernel = DDG4.Kernel()
+  kernel.loadGeometry(str("file:" + geometry))
+  geant4 = DDG4.Geant4(kernel)
+  geant4.setupUI(typ="tcsh", vis=False, macro=None, ui=False)
+
+  # Configure G4 geometry setup and check the converted solids
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  act.NumberOfThreads = int(args.threads) if args.threads else 1
+  act.OutputLevel = Output.INFO
+  seq, act = geant4.addDetectorConstruction("TestTessellatedSolidCheck/TessellatedCheck")
+
+  # Now build the physics list:
+  geant4.setupPhysics('QGSP_BERT')
+  kernel.NumEvents = 0
+  kernel.configure()
+  kernel.initialize()
+  kernel.run()
+  kernel.terminate()
+
+
+if __name__ == "__main__":
+  run()
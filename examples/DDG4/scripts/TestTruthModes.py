@@ -0,0 +1,81 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+import logging
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+#
+#
+"""
+
+   Check the Monte Carlo truth record of calorimeter hits for the
+   truth modes of the sensitive actions, which merge the contributions
+   per track.
+
+"""
+
+
+def run():
+  import os
+  import sys
+  import DDG4
+  from DDG4 import OutputLevel as Output
+  from g4units import GeV
+
+  args = DDG4.CommandLine()
+  install_dir = os.environ['DD4hepExamplesINSTALL'] + "/examples/ClientTests/compact"
+  if args.help or not args.truth_mode:
+    logger.info("""
+         python <dir>/TestTruthModes.py -option [-option]
+              -truth_mode <number>       Truth mode of the calorimeter actions (1, 2 or 3)
+              -max_contributions <num>   Maximal number of track contributions in truth mode 2
+              -events     <number>       Number of events to be simulated
+    """)
+    sys.exit(0)
+
+  truth_mode = int(args.truth_mode)
+  max_contributions = int(args.max_contributions) if args.max_contributions else 3
+  kernel = DDG4.Kernel()
+  kernel.loadGeometry(str("file:" + install_dir + os.sep + "CaloEndcapReflection.xml"))
+
+  DDG4.importConstants(kernel.detectorDescription(), debug=False)
+  geant4 = DDG4.Geant4(kernel, calo='Geant4CalorimeterAction')
+  geant4.printDetectors()
+  geant4.setupUI(typ="tcsh", vis=False, macro=None, ui=False)
+
+  # Configure G4 geometry setup
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorSensitivesConstruction/ConstructSD")
+  seq, actions = geant4.setupDetectors()
+  for act in actions:
+    act.TruthMode = truth_mode
+    act.TruthMaxContributions = max_contributions
+
+  # Setup particle gun: electron showers
+  gun = geant4.setupGun("Gun", particle='e-', energy=10 * GeV, multiplicity=5, isotrop=True)
+  gun.OutputLevel = Output.INFO
+  kernel.NumEvents = int(args.events) if args.events else 5
+
+  # Instantiate the checking event action
+  check = DDG4.EventAction(kernel, 'TestTruthModeAction/TruthCheck')
+  check.MaxContributions = max_contributions if truth_mode == 2 else 0
+  kernel.eventAction().add(check)
+
+  # Now build the physics list:
+  phys = geant4.setupPhysics('QGSP_BERT')
+  phys.dump()
+  # Start the engine...
+  geant4.execute()
+
+
+if __name__ == "__main__":
+  run()
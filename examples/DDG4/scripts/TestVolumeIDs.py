@@ -0,0 +1,92 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+#
+import logging
+#
+logging.basicConfig(format='%(levelname)s: %(message)s', level=logging.INFO)
+logger = logging.getLogger(__name__)
+#
+#
+"""
+
+   Check the volume identifiers of the Geant4VolumeManager for every
+   step in a sensitive volume of one of the ClientTests geometries.
+
+"""
+
+
+def run():
+  import os
+  import sys
+  import DDG4
+  from DDG4 import OutputLevel as Output
+  from g4units import GeV
+
+  args = DDG4.CommandLine()
+  install_dir = os.environ['DD4hepExamplesINSTALL'] + "/examples/ClientTests/compact"
+  if args.help or not args.geometry:
+    logger.info("""
+         python <dir>/TestVolumeIDs.py -option [-option]
+              -geometry <file name>      Geometry file in """ + install_dir + """
+              -events   <number>         Number of events to be simulated
+              -volume_cache              Check Geant4Sensitive::volumeID with the last-volume cache enabled
+              -replicas <number>         Parameterise at least <number> regularly placed identical volumes
+              -freeze                    Release the conversion-only maps of the geometry info
+              -print_volume <path>       Print the Geant4 volume <path> with the UI before the run
+    """)
+    sys.exit(0)
+
+  kernel = DDG4.Kernel()
+  kernel.loadGeometry(str("file:" + install_dir + os.sep + args.geometry))
+
+  DDG4.importConstants(kernel.detectorDescription(), debug=False)
+  if args.volume_cache:
+    geant4 = DDG4.Geant4(kernel, tracker='TestVolumeCacheSD', calo='TestVolumeCacheSD')
+  else:
+    geant4 = DDG4.Geant4(kernel, tracker='Geant4TrackerCombineAction', calo='Geant4CalorimeterAction')
+  geant4.printDetectors()
+  ui = geant4.setupUI(typ="tcsh", vis=False, macro=None, ui=False)
+  geant4.setupTrackingField(prt=True)
+
+  # Configure G4 geometry setup
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorGeometryConstruction/ConstructGeo")
+  if args.replicas:
+    act.DetectReplicas = int(args.replicas)
+  if args.freeze:
+    act.FreezeGeometryInfo = True
+  seq, act = geant4.addDetectorConstruction("Geant4DetectorSensitivesConstruction/ConstructSD")
+  seq, actions = geant4.setupDetectors()
+  if args.volume_cache:
+    for act in actions:
+      act.UseVolumeCache = True
+
+  # Setup particle gun
+  gun = geant4.setupGun("Gun", particle='mu-', energy=10 * GeV, multiplicity=20, isotrop=True)
+  gun.OutputLevel = Output.INFO
+  num_events = int(args.events) if args.events else 5
+  kernel.NumEvents = num_events
+  if args.print_volume:
+    ui.Commands = ['/ddg4/ConstructGeo/printVolume ' + args.print_volume,
+                   '/run/beamOn ' + str(num_events)]
+
+  # Instantiate the checking stepping action
+  stepping = DDG4.SteppingAction(kernel, 'TestVolumeIDAction/VolumeIDCheck')
+  kernel.steppingAction().add(stepping)
+
+  # Now build the physics list:
+  phys = geant4.setupPhysics('QGSP_BERT')
+  phys.dump()
+  # Start the engine...
+  geant4.execute()
+
+
+if __name__ == "__main__":
+  run()
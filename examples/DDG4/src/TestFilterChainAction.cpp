@@ -0,0 +1,131 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//==========================================================================
+
+// Framework include files
+#include "DDG4/Geant4Kernel.h"
+#include "DDG4/Geant4SensDetAction.h"
+#include "DDG4/Geant4SteppingAction.h"
+
+#include <G4Step.hh>
+#include <G4SteppingControl.hh>
+#include <G4VSensitiveDetector.hh>
+
+#include <vector>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    namespace {
+      /// Last step handed to a TestFilterChainSD of this thread. Reset by TestFilterChainAction
+      thread_local const G4Step* s_lastAcceptedStep = nullptr;
+    }
+
+    /// Generic filter without fused term: accept tracks above a minimal momentum
+    /**
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class TestMomentumFilter : public Geant4Filter {
+      /// Property: Minimal momentum of the track
+      double m_minMomentum { 0e0 };
+    public:
+      /// Standard constructor
+      TestMomentumFilter(Geant4Context* context, const std::string& nam)
+        : Geant4Filter(context, nam)
+      {
+        declareProperty("MinMomentum", m_minMomentum);
+      }
+      using Geant4Filter::operator();
+      /// Filter action. Return true if hits should be processed
+      virtual bool operator()(const G4Step* step) const  override  {
+        return step->GetPreStepPoint()->GetMomentum().mag() > m_minMomentum;
+      }
+    };
+
+    /// Sensitive action recording the steps accepted by the filters of its sequence
+    /**
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class TestFilterChainSD : public Geant4Sensitive {
+    public:
+      /// Standard constructor
+      TestFilterChainSD(Geant4Context* ctxt, const std::string& nam, DetElement det, Detector& description)
+        : Geant4Sensitive(ctxt, nam, det, description)
+      {
+      }
+      /// Method for generating hit(s) using the information of G4Step object.
+      virtual bool process(const G4Step* step, G4TouchableHistory*)  override  {
+        s_lastAcceptedStep = step;
+        return true;
+      }
+    };
+
+    /// Stepping action to check the filter chain of the sensitive detector sequences
+    /** All sensitive detectors must use TestFilterChainSD and the global filters
+     *  given by the property Filters. Every step in a sensitive volume must reach
+     *  the sensitive action if and only if all filters accept it individually.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class TestFilterChainAction : public Geant4SteppingAction {
+      /// Property: Names of the global filters used by the sensitive detectors
+      std::vector<std::string>         m_filterNames  { };
+      std::vector<const Geant4Filter*> m_filters      { };
+      std::size_t m_num_steps    { 0UL };
+      std::size_t m_num_accepted { 0UL };
+      std::size_t m_num_errors   { 0UL };
+
+    public:
+      /// Standard constructor
+      TestFilterChainAction(Geant4Context* context, const std::string& nam)
+        : Geant4SteppingAction(context, nam)
+      {
+        declareProperty("Filters", m_filterNames);
+      }
+      /// Default destructor
+      virtual ~TestFilterChainAction()   {
+        info("+++ Checked %ld sensitive steps with %ld accepted: %ld filter errors.",
+             m_num_steps, m_num_accepted, m_num_errors);
+      }
+      /// User stepping callback
+      virtual void operator()(const G4Step* step, G4SteppingManager*)  override  {
+        if ( m_filters.size() != m_filterNames.size() )  {
+          m_filters.clear();
+          for( const auto& nam : m_filterNames )
+            m_filters.emplace_back(dynamic_cast<Geant4Filter*>(context()->kernel().globalFilter(nam)));
+        }
+        const G4Step* received = s_lastAcceptedStep;
+        s_lastAcceptedStep = nullptr;
+        if ( !step->GetPreStepPoint()->GetSensitiveDetector() || step->GetControlFlag() == AvoidHitInvocation )
+          return;
+        bool expected = true;
+        for( const Geant4Filter* filter : m_filters )
+          expected = expected && filter && (*filter)(step);
+        ++m_num_steps;
+        if ( expected ) ++m_num_accepted;
+        if ( expected != (received == step) && ++m_num_errors <= 10 )  {
+          error("+++ Step of track %d %s by the filter chain.", step->GetTrack()->GetTrackID(),
+                expected ? "wrongly rejected" : "wrongly accepted");
+        }
+      }
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+
+#include "DDG4/Factories.h"
+DECLARE_GEANT4ACTION_NS(dd4hep::sim,TestMomentumFilter)
+DECLARE_GEANT4SENSITIVE_NS(dd4hep::sim,TestFilterChainSD)
+DECLARE_GEANT4ACTION_NS(dd4hep::sim,TestFilterChainAction)
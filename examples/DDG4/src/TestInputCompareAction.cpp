@@ -0,0 +1,100 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//==========================================================================
+
+// Framework include files
+#include "DDG4/Geant4GeneratorAction.h"
+#include "DDG4/Geant4Primary.h"
+#include "DDG4/Geant4Particle.h"
+
+#include <G4Event.hh>
+
+#include <vector>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Class to compare primary interactions read by differently configured input actions
+    /** The particles of the interactions with the masks given by the property Masks
+     *  must be identical to the particles of the interaction with the mask Reference.
+     *  Must be called after the input actions and before the interaction merger.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class TestInputCompareAction : public Geant4GeneratorAction {
+      /// Property: Mask of the reference interaction
+      int              m_reference        { 1 };
+      /// Property: Masks of the interactions to be compared with the reference
+      std::vector<int> m_masks            { };
+      std::size_t      m_num_events       { 0UL };
+      std::size_t      m_num_particles    { 0UL };
+      std::size_t      m_num_differences  { 0UL };
+
+    public:
+      /// Standard constructor
+      TestInputCompareAction(Geant4Context* context, const std::string& nam)
+        : Geant4GeneratorAction(context, nam)
+      {
+        declareProperty("Reference", m_reference);
+        declareProperty("Masks",     m_masks);
+      }
+      /// Default destructor
+      virtual ~TestInputCompareAction()   {
+        info("+++ Compared %ld events with %ld particles: %ld differences.",
+             m_num_events, m_num_particles, m_num_differences);
+      }
+      /// Callback to compare the primary interactions
+      virtual void operator()(G4Event* event)  override  {
+        Geant4PrimaryEvent* evt = context()->event().extension<Geant4PrimaryEvent>();
+        Geant4PrimaryInteraction* ref = evt->get(m_reference);
+        if ( !ref )  {
+          check(false, event, m_reference, "no reference interaction");
+          return;
+        }
+        for( int mask : m_masks )  {
+          Geant4PrimaryInteraction* inter = evt->get(mask);
+          if ( !inter )  {
+            check(false, event, mask, "no interaction");
+            continue;
+          }
+          check(inter->particles.size() == ref->particles.size(), event, mask, "different number of particles");
+          check(inter->vertices.size() == ref->vertices.size(), event, mask, "different number of vertices");
+          for( auto i = ref->particles.begin(), j = inter->particles.begin();
+               i != ref->particles.end() && j != inter->particles.end(); ++i, ++j )  {
+            const Geant4Particle* p = i->second;
+            const Geant4Particle* q = j->second;
+            check(p->id == q->id && p->pdgID == q->pdgID && p->status == q->status &&
+                  p->genStatus == q->genStatus && p->charge == q->charge, event, mask, "different particle");
+            check(p->psx == q->psx && p->psy == q->psy && p->psz == q->psz && p->mass == q->mass,
+                  event, mask, "different momentum");
+            check(p->vsx == q->vsx && p->vsy == q->vsy && p->vsz == q->vsz && p->time == q->time,
+                  event, mask, "different vertex");
+            check(p->parents == q->parents && p->daughters == q->daughters, event, mask, "different lineage");
+          }
+        }
+        m_num_particles += ref->particles.size();
+        ++m_num_events;
+      }
+      /// Count and print differences
+      void check(bool good, const G4Event* event, int mask, const char* reason)  {
+        if( !good && ++m_num_differences <= 10 )  {
+          error("+++ Event %d interaction %d: %s.", event->GetEventID(), mask, reason);
+        }
+      }
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+
+#include "DDG4/Factories.h"
+DECLARE_GEANT4ACTION_NS(dd4hep::sim,TestInputCompareAction)
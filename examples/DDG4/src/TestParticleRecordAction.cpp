@@ -0,0 +1,110 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//==========================================================================
+
+// Framework include files
+#include "DDG4/Geant4Data.h"
+#include "DDG4/Geant4Particle.h"
+#include "DDG4/Geant4EventAction.h"
+#include "DDG4/Geant4HitCollection.h"
+
+#include <G4Event.hh>
+#include <G4HCofThisEvent.hh>
+
+#include <typeinfo>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Class to check the consistency of the particle record of Geant4ParticleHandler
+    /** Check the particle record handed to the event at the end of the event
+     *
+     *  Every particle must be registered with its own identifier, all parents and
+     *  daughters must be present, every track equivalent must point to a particle
+     *  and the track identifiers of all hit contributions must have an equivalent.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class TestParticleRecordAction : public Geant4EventAction {
+      std::size_t m_num_particles     { 0UL };
+      std::size_t m_num_contributions { 0UL };
+      std::size_t m_num_errors        { 0UL };
+
+      /// Count and print errors
+      void check(bool good, int id, const char* reason)  {
+        if( !good && ++m_num_errors <= 10 )  {
+          error("+++ Identifier %d: %s.", id, reason);
+        }
+      }
+      /// Check the track identifier of a hit contribution
+      void check_contribution(const Geant4ParticleMap* pm, const Geant4HitData::Contribution& c)  {
+        check(pm->equivalents().find(c.trackID) != pm->equivalents().end(), c.trackID,
+              "hit contribution without equivalent particle");
+        ++m_num_contributions;
+      }
+
+    public:
+      /// Standard constructor
+      TestParticleRecordAction(Geant4Context* context, const std::string& nam)
+        : Geant4EventAction(context, nam)
+      {
+      }
+      /// Default destructor
+      virtual ~TestParticleRecordAction()   {
+        info("+++ Checked %ld particles and %ld hit contributions: %ld particle record errors.",
+             m_num_particles, m_num_contributions, m_num_errors);
+      }
+      /// End-of-event callback
+      virtual void end(const G4Event* event)  override  {
+        const Geant4ParticleMap* pm = context()->event().extension<Geant4ParticleMap>(false);
+        if( !pm )  {
+          check(false, event->GetEventID(), "event without particle record");
+          return;
+        }
+        const auto& particles = pm->particles();
+        for( const auto& [id, p] : particles )  {
+          check(p->id == id, id, "particle registered with a wrong identifier");
+          for( int parent : p->parents )
+            check(particles.find(parent) != particles.end(), parent, "missing parent");
+          for( int daughter : p->daughters )
+            check(particles.find(daughter) != particles.end(), daughter, "missing daughter");
+          ++m_num_particles;
+        }
+        for( const auto& [track, id] : pm->equivalents() )
+          check(particles.find(id) != particles.end(), track, "track equivalent without particle");
+
+        G4HCofThisEvent* hce = event->GetHCofThisEvent();
+        for( int i = 0, n = hce ? hce->GetNumberOfCollections() : 0; i < n; ++i )  {
+          Geant4HitCollection* coll = dynamic_cast<Geant4HitCollection*>(hce->GetHC(i));
+          if( !coll )
+            continue;
+          for( std::size_t j = 0; j < coll->GetSize(); ++j )  {
+            if( coll->type().type() == typeid(Geant4Tracker::Hit) )  {
+              Geant4Tracker::Hit* hit = coll->hit(j);
+              check_contribution(pm, hit->truth);
+            }
+            else if( coll->type().type() == typeid(Geant4Calorimeter::Hit) )  {
+              Geant4Calorimeter::Hit* hit = coll->hit(j);
+              for( const auto& c : hit->truth )
+                check_contribution(pm, c);
+            }
+          }
+        }
+      }
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+
+#include "DDG4/Factories.h"
+DECLARE_GEANT4ACTION_NS(dd4hep::sim,TestParticleRecordAction)
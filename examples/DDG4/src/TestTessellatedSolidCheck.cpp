@@ -0,0 +1,97 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//==========================================================================
+
+// Framework include files
+#include "DDG4/Geant4DetectorConstruction.h"
+#include "DDG4/Geant4GeometryInfo.h"
+#include "DD4hep/DD4hepUnits.h"
+
+#include <G4TessellatedSolid.hh>
+#include <CLHEP/Units/SystemOfUnits.h>
+#include <TGeoTessellated.h>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Detector construction action to check the converted tessellated solids
+    /** Must be called after the geometry conversion. Every tessellated shape must
+     *  be converted to a G4TessellatedSolid with the same number of facets, and
+     *  the points of a regular grid in the bounding box must be inside both
+     *  shapes or outside both shapes. Points closer to the surface than the
+     *  property Tolerance are not checked.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class TestTessellatedSolidCheck : public Geant4DetectorConstruction {
+      /// Property: Number of grid points per dimension of the bounding box
+      int    m_numPoints  { 20 };
+      /// Property: Minimal distance of the checked points to the surface
+      double m_tolerance  { 1e-3 * dd4hep::cm };
+
+    public:
+      /// Standard constructor
+      TestTessellatedSolidCheck(Geant4Context* context, const std::string& nam)
+        : Geant4DetectorConstruction(context, nam)
+      {
+        declareProperty("NumPoints", m_numPoints);
+        declareProperty("Tolerance", m_tolerance);
+      }
+      /// Default destructor
+      virtual ~TestTessellatedSolidCheck() = default;
+      /// Geometry construction callback: check the converted solids
+      virtual void constructGeo(Geant4DetectorConstructionContext* ctxt)  override  {
+        constexpr double CM_2_MM = (CLHEP::centimeter/dd4hep::centimeter);
+        std::size_t num_solids = 0, num_points = 0, num_differences = 0;
+        for( const auto& s : ctxt->geometry->g4Solids )  {
+          if( !s.first || s.first->IsA() != TGeoTessellated::Class() )
+            continue;
+          const auto* sh = (const TGeoTessellated*)s.first;
+          const auto* g4 = dynamic_cast<const G4TessellatedSolid*>(s.second);
+          ++num_solids;
+          if( !g4 || g4->GetNumberOfFacets() != sh->GetNfacets() )  {
+            error("+++ Solid %s: wrong Geant4 solid or number of facets.", sh->GetName());
+            ++num_differences;
+            continue;
+          }
+          const Double_t* o = sh->GetOrigin();
+          const double    d[3] = { sh->GetDX(), sh->GetDY(), sh->GetDZ() };
+          for( int i = 0; i < m_numPoints; ++i )  {
+            for( int j = 0; j < m_numPoints; ++j )  {
+              for( int k = 0; k < m_numPoints; ++k )  {
+                Double_t p[3] = { o[0] + d[0] * (2.0 * (i + 0.5) / m_numPoints - 1.0),
+                                  o[1] + d[1] * (2.0 * (j + 0.5) / m_numPoints - 1.0),
+                                  o[2] + d[2] * (2.0 * (k + 0.5) / m_numPoints - 1.0) };
+                bool inside = sh->Contains(p);
+                if( sh->Safety(p, inside) < m_tolerance )
+                  continue;
+                EInside g4_inside = g4->Inside(G4ThreeVector(p[0] * CM_2_MM, p[1] * CM_2_MM, p[2] * CM_2_MM));
+                ++num_points;
+                if( (g4_inside == kInside) != inside && ++num_differences <= 10 )  {
+                  error("+++ Solid %s: point (%g,%g,%g) is %s the Geant4 solid.", sh->GetName(),
+                        p[0], p[1], p[2], inside ? "outside" : "inside");
+                }
+              }
+            }
+          }
+        }
+        info("+++ Checked %ld tessellated solids with %ld points: %ld differences.",
+             num_solids, num_points, num_differences);
+      }
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+
+#include "DDG4/Factories.h"
+DECLARE_GEANT4ACTION_NS(dd4hep::sim,TestTessellatedSolidCheck)
@@ -0,0 +1,100 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//==========================================================================
+
+// Framework include files
+#include "DDG4/Geant4Data.h"
+#include "DDG4/Geant4EventAction.h"
+#include "DDG4/Geant4HitCollection.h"
+
+#include <G4Event.hh>
+#include <G4HCofThisEvent.hh>
+
+#include <cmath>
+#include <set>
+#include <typeinfo>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Class to check the Monte Carlo truth record of calorimeter hits
+    /** Check the truth contributions of all calorimeter hits at the end of the event
+     *  for the truth modes of Geant4Sensitive, which merge the contributions per track.
+     *
+     *  The summed deposits of the contributions must match the hit energy, every
+     *  track may appear only once and at most MaxContributions track entries plus
+     *  one entry of the dropped tracks may be present. MaxContributions <= 0
+     *  disables the check of the number of entries.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class TestTruthModeAction : public Geant4EventAction {
+      /// Property: Maximal number of track contributions per hit
+      int         m_maxContributions  { 0 };
+      /// Property: Relative tolerance of the summed deposits
+      double      m_tolerance         { 1e-9 };
+      std::size_t m_num_hits          { 0UL };
+      std::size_t m_num_contributions { 0UL };
+      std::size_t m_num_errors        { 0UL };
+
+    public:
+      /// Standard constructor
+      TestTruthModeAction(Geant4Context* context, const std::string& nam)
+        : Geant4EventAction(context, nam)
+      {
+        declareProperty("MaxContributions", m_maxContributions);
+        declareProperty("Tolerance",        m_tolerance);
+      }
+      /// Default destructor
+      virtual ~TestTruthModeAction()   {
+        info("+++ Checked %ld calorimeter hits with %ld contributions: %ld truth errors.",
+             m_num_hits, m_num_contributions, m_num_errors);
+      }
+      /// End-of-event callback
+      virtual void end(const G4Event* event)  override  {
+        G4HCofThisEvent* hce = event->GetHCofThisEvent();
+        for( int i = 0, n = hce ? hce->GetNumberOfCollections() : 0; i < n; ++i )  {
+          Geant4HitCollection* coll = dynamic_cast<Geant4HitCollection*>(hce->GetHC(i));
+          if( !coll || coll->type().type() != typeid(Geant4Calorimeter::Hit) )
+            continue;
+          for( std::size_t j = 0; j < coll->GetSize(); ++j )  {
+            Geant4Calorimeter::Hit* hit = coll->hit(j);
+            std::set<int> tracks;
+            double        deposit = 0e0;
+            for( const auto& c : hit->truth )  {
+              deposit += c.deposit;
+              if( !tracks.insert(c.trackID).second )
+                check(false, coll, "duplicated track contribution");
+            }
+            check(std::fabs(deposit - hit->energyDeposit) <= m_tolerance * std::fabs(hit->energyDeposit),
+                  coll, "summed contributions differ from the hit deposit");
+            check(m_maxContributions <= 0 || hit->truth.size() <= std::size_t(m_maxContributions) + 1,
+                  coll, "too many track contributions");
+            m_num_contributions += hit->truth.size();
+            ++m_num_hits;
+          }
+        }
+      }
+      /// Count and print errors
+      void check(bool good, const Geant4HitCollection* coll, const char* reason)  {
+        if( !good && ++m_num_errors <= 10 )  {
+          error("+++ Collection %s: %s.", coll->GetName().c_str(), reason);
+        }
+      }
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+
+#include "DDG4/Factories.h"
+DECLARE_GEANT4ACTION_NS(dd4hep::sim,TestTruthModeAction)
@@ -0,0 +1,69 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//==========================================================================
+
+// Framework include files
+#include "DDG4/Geant4Mapping.h"
+#include "DDG4/Geant4VolumeManager.h"
+#include "DDG4/Geant4SensDetAction.h"
+
+#include <G4Step.hh>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Sensitive action to check the volume identifiers of Geant4Sensitive against the volume manager
+    /** Check the volume identifiers of Geant4Sensitive
+     *
+     *  The volume identifier of every step is computed with Geant4Sensitive::volumeID,
+     *  which uses the last-volume cache if the property UseVolumeCache is set, and
+     *  directly with the Geant4VolumeManager. Both must be identical.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class TestVolumeCacheSD : public Geant4Sensitive {
+      std::size_t m_num_steps  { 0UL };
+      std::size_t m_num_errors { 0UL };
+
+    public:
+      /// Standard constructor
+      TestVolumeCacheSD(Geant4Context* ctxt, const std::string& nam, DetElement det, Detector& description)
+        : Geant4Sensitive(ctxt, nam, det, description)
+      {
+      }
+      /// Default destructor
+      virtual ~TestVolumeCacheSD()   {
+        info("+++ Volume cache check: %ld steps: %ld errors. %lu cache hits.",
+             m_num_steps, m_num_errors, volumeCacheHits());
+      }
+      /// Method for generating hit(s) using the information of G4Step object.
+      virtual bool process(const G4Step* step, G4TouchableHistory*)  override  {
+        Geant4VolumeManager volMgr = Geant4Mapping::instance().volumeManager();
+        VolumeID direct = volMgr.volumeID(step->GetPreStepPoint()->GetTouchable());
+        VolumeID vid    = volumeID(step);
+        ++m_num_steps;
+        if( vid != VolumeID(direct) )  {
+          if( ++m_num_errors <= 10 )  {
+            error("+++ Volume ID mismatch: %016llX [Geant4Sensitive] != %016llX [Geant4VolumeManager]",
+                  (unsigned long long)vid, (unsigned long long)direct);
+          }
+        }
+        return true;
+      }
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+
+#include "DDG4/Factories.h"
+DECLARE_GEANT4SENSITIVE_NS(dd4hep::sim,TestVolumeCacheSD)
@@ -0,0 +1,108 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+//==========================================================================
+
+// Framework include files
+#include "DD4hep/Detector.h"
+#include "DD4hep/VolumeManager.h"
+#include "DD4hep/DD4hepUnits.h"
+#include "DDG4/Geant4Mapping.h"
+#include "DDG4/Geant4VolumeManager.h"
+#include "DDG4/Geant4SteppingAction.h"
+
+#include <G4Step.hh>
+#include <G4VTouchable.hh>
+#include <G4LogicalVolume.hh>
+#include <G4VPhysicalVolume.hh>
+#include <CLHEP/Units/SystemOfUnits.h>
+
+#include <TGeoShape.h>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Geant4 based simulation part of the AIDA detector description toolkit
+  namespace sim {
+
+    /// Class to check the volume identifiers of all steps in sensitive volumes
+    /** Check the volume identifiers computed by the Geant4VolumeManager
+     *
+     *  For every step in a sensitive volume the volume identifier is computed
+     *  from the Geant4 touchable. The dd4hep volume manager then resolves the
+     *  identifier to a placement: the step midpoint must be inside the
+     *  solid of this placement.
+     *
+     *  \version 1.0
+     *  \ingroup DD4HEP_SIMULATION
+     */
+    class TestVolumeIDAction : public Geant4SteppingAction {
+      /// Property: Distance tolerance of the midpoint to the solid
+      double      m_tolerance       { 1e-3*dd4hep::mm };
+      /// Property: Maximal number of errors printed
+      std::size_t m_maxPrint        { 10UL };
+      std::size_t m_num_steps       { 0UL };
+      std::size_t m_num_errors      { 0UL };
+
+    public:
+      /// Standard constructor
+      TestVolumeIDAction(Geant4Context* context, const std::string& nam)
+        : Geant4SteppingAction(context, nam)
+      {
+        declareProperty("Tolerance", m_tolerance);
+        declareProperty("MaxPrint",  m_maxPrint);
+      }
+      /// Default destructor
+      virtual ~TestVolumeIDAction()   {
+        info("+++ Checked %ld sensitive steps: %ld volume ID errors.", m_num_steps, m_num_errors);
+      }
+      /// stepping callback
+      virtual void operator()(const G4Step* step, G4SteppingManager*) {
+        const G4VTouchable* touch = step->GetPreStepPoint()->GetTouchable();
+        const G4VPhysicalVolume* phys = touch->GetVolume();
+        if( !phys || !phys->GetLogicalVolume()->GetSensitiveDetector() )
+          return;
+
+        Geant4VolumeManager g4_mgr = Geant4Mapping::instance().volumeManager();
+        VolumeManager       dd_mgr = context()->detectorDescription().volumeManager();
+        VolumeID            vid    = g4_mgr.volumeID(touch);
+        const char*         reason = nullptr;
+        ++m_num_steps;
+        if( vid == Geant4VolumeManager::NonExisting ||
+            vid == Geant4VolumeManager::Insensitive ||
+            vid == Geant4VolumeManager::InvalidPath )  {
+          reason = "no volume identifier";
+        }
+        else if( VolumeManagerContext* ctxt = dd_mgr.lookupContext(vid) )  {
+          G4ThreeVector mid = 0.5*(step->GetPreStepPoint()->GetPosition() + step->GetPostStepPoint()->GetPosition());
+          double world[3] = { mid.x()/CLHEP::mm*dd4hep::mm, mid.y()/CLHEP::mm*dd4hep::mm, mid.z()/CLHEP::mm*dd4hep::mm };
+          double elt[3], local[3];
+          ctxt->worldToElement(world, elt);
+          ctxt->toElement().MasterToLocal(elt, local);
+          const TGeoShape* shape = ctxt->volumePlacement().volume().solid().ptr();
+          if( !shape->Contains(local) && shape->Safety(local, kFALSE) > m_tolerance )  {
+            reason = "step outside of the identified volume";
+          }
+        }
+        else  {
+          reason = "unknown volume identifier";
+        }
+        if( reason )  {
+          if( ++m_num_errors <= m_maxPrint )  {
+            error("+++ Volume %s copy %d: volume ID %016llX: %s.",
+                  phys->GetName().c_str(), touch->GetCopyNumber(), (unsigned long long)vid, reason);
+          }
+        }
+      }
+    };
+  }    // End namespace sim
+}      // End namespace dd4hep
+
+#include "DDG4/Factories.h"
+DECLARE_GEANT4ACTION_NS(dd4hep::sim,TestVolumeIDAction)